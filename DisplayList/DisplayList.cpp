@@ -0,0 +1,314 @@
+// Display list renderer for color LCDs without a frame buffer
+// MIT license
+
+#include "DisplayList.h"
+#include "glcdfont.c"
+#include <avr/pgmspace.h>
+
+#define DL_FILLRECT   0
+#define DL_RECT       1
+#define DL_LINE       2
+#define DL_CIRCLE     3
+#define DL_FILLCIRCLE 4
+#define DL_STRING     5
+
+#define swap(a, b) { int16_t t = a; a = b; b = t; }
+
+DisplayList::DisplayList(uint16_t w, uint16_t h) {
+  _width = w;
+  _height = h;
+  clear(0);
+}
+
+void DisplayList::clear(uint16_t color) {
+  _count = 0;
+  _bg = color;
+}
+
+uint8_t DisplayList::count(void) {
+  return _count;
+}
+
+DisplayListItem *DisplayList::add(uint8_t type, int16_t x, int16_t y, 
+				  int16_t w, int16_t h, uint16_t color) {
+  if (_count >= DISPLAYLIST_ITEMS) return 0;
+
+  DisplayListItem *item = &items[_count++];
+
+  item->type = type;
+  item->x = x;
+  item->y = y;
+  item->w = w;
+  item->h = h;
+  item->color = color;
+  return item;
+}
+
+/********************************* recording */
+
+boolean DisplayList::fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, 
+			      uint16_t color) {
+  return add(DL_FILLRECT, x, y, w, h, color) != 0;
+}
+
+boolean DisplayList::drawRect(int16_t x, int16_t y, uint16_t w, uint16_t h, 
+			      uint16_t color) {
+  return add(DL_RECT, x, y, w, h, color) != 0;
+}
+
+boolean DisplayList::drawHorizontalLine(int16_t x, int16_t y, uint16_t length, 
+					uint16_t color) {
+  return add(DL_FILLRECT, x, y, length, 1, color) != 0;
+}
+
+boolean DisplayList::drawVerticalLine(int16_t x, int16_t y, uint16_t length, 
+				      uint16_t color) {
+  return add(DL_FILLRECT, x, y, 1, length, color) != 0;
+}
+
+boolean DisplayList::drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, 
+			      uint16_t color) {
+  return add(DL_LINE, x0, y0, x1, y1, color) != 0;
+}
+
+boolean DisplayList::drawCircle(int16_t x0, int16_t y0, uint16_t r, 
+				uint16_t color) {
+  return add(DL_CIRCLE, x0, y0, r, 0, color) != 0;
+}
+
+boolean DisplayList::fillCircle(int16_t x0, int16_t y0, uint16_t r, 
+				uint16_t color) {
+  return add(DL_FILLCIRCLE, x0, y0, r, 0, color) != 0;
+}
+
+boolean DisplayList::drawString(int16_t x, int16_t y, const char *c, 
+				uint16_t color, uint8_t size) {
+  return drawString(x, y, c, color, color, size);
+}
+
+boolean DisplayList::drawString(int16_t x, int16_t y, const char *c, 
+				uint16_t color, uint16_t bg, uint8_t size) {
+  DisplayListItem *item = add(DL_STRING, x, y, strlen(c) * 6 * size, 8 * size, color);
+
+  if (!item) return false;
+  item->bg = bg;
+  item->size = size;
+  item->str = c;
+  return true;
+}
+
+/********************************* rendering */
+
+void DisplayList::render(DisplayList_WindowFunc window, DisplayList_PixelFunc pixels) {
+  render(0, 0, _width, _height, window, pixels);
+}
+
+// The area is cut into tiles that fit the buffer. When a whole row
+// of the area fits they are strips, which follow on from each other,
+// so the area is a single window.
+void DisplayList::render(int16_t x, int16_t y, uint16_t w, uint16_t h, 
+			 DisplayList_WindowFunc window, DisplayList_PixelFunc pixels) {
+  uint16_t tile[DISPLAYLIST_BUFFER];
+  uint16_t tw, th;
+  uint8_t strips;
+
+  // clip to the screen
+  if (x < 0) { w = w > -x ? w + x : 0; x = 0; }
+  if (y < 0) { h = h > -y ? h + y : 0; y = 0; }
+  if (x + w > _width) w = x < _width ? _width - x : 0;
+  if (y + h > _height) h = y < _height ? _height - y : 0;
+  if ((w == 0) || (h == 0)) return;
+
+  tw = w < DISPLAYLIST_BUFFER ? w : DISPLAYLIST_BUFFER;
+  th = DISPLAYLIST_BUFFER / tw;
+  strips = tw == w;
+  if (strips)
+    window(x, y, w, h);
+
+  _tile = tile;
+  for (_ty = y; _ty < y + h; _ty += th) {
+    _th = y + h - _ty < th ? y + h - _ty : th;
+    for (_tx = x; _tx < x + w; _tx += tw) {
+      _tw = x + w - _tx < tw ? x + w - _tx : tw;
+
+      for (uint16_t i = 0; i < _tw * _th; i++)
+	tile[i] = _bg;
+      for (uint8_t i = 0; i < _count; i++)
+	paint(&items[i]);
+
+      if (!strips)
+	window(_tx, _ty, _tw, _th);
+      pixels(tile, _tw * _th);
+    }
+  }
+}
+
+// fill the part of a rectangle that is in the tile
+void DisplayList::span(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color) {
+  int16_t x1 = x + w, y1 = y + h;
+
+  if (x < _tx) x = _tx;
+  if (y < _ty) y = _ty;
+  if (x1 > _tx + _tw) x1 = _tx + _tw;
+  if (y1 > _ty + _th) y1 = _ty + _th;
+
+  for (; y < y1; y++) {
+    uint16_t *p = _tile + (y - _ty) * _tw + (x - _tx);
+    for (int16_t i = x; i < x1; i++)
+      *p++ = color;
+  }
+}
+
+void DisplayList::plot(int16_t x, int16_t y, uint16_t color) {
+  if ((x >= _tx) && (x < _tx + _tw) && (y >= _ty) && (y < _ty + _th))
+    _tile[(y - _ty) * _tw + (x - _tx)] = color;
+}
+
+// Paint the part of a primitive that is in the tile.
+// Lines and circles are the same algorithms as the LCD libraries use
+// so they look the same, run again for each tile they touch.
+void DisplayList::paint(DisplayListItem *item) {
+  int16_t x0 = item->x, y0 = item->y;
+  uint16_t color = item->color;
+
+  switch (item->type) {
+  case DL_FILLRECT:
+  case DL_RECT:
+  case DL_STRING:
+    if ((x0 >= _tx + _tw) || (x0 + item->w <= _tx) ||
+	(y0 >= _ty + _th) || (y0 + item->h <= _ty))
+      return;
+    break;
+  case DL_LINE:
+    // both ends on the same side of the tile
+    if (((x0 >= _tx + _tw) && (item->w >= _tx + _tw)) || 
+	((x0 < _tx) && (item->w < _tx)) ||
+	((y0 >= _ty + _th) && (item->h >= _ty + _th)) || 
+	((y0 < _ty) && (item->h < _ty)))
+      return;
+    break;
+  case DL_CIRCLE:
+  case DL_FILLCIRCLE:
+    if ((x0 - item->w >= _tx + _tw) || (x0 + item->w < _tx) ||
+	(y0 - item->w >= _ty + _th) || (y0 + item->w < _ty))
+      return;
+    break;
+  }
+
+  switch (item->type) {
+  case DL_FILLRECT:
+    span(x0, y0, item->w, item->h, color);
+    break;
+
+  case DL_RECT:
+    span(x0, y0, item->w, 1, color);
+    span(x0, y0 + item->h - 1, item->w, 1, color);
+    span(x0, y0, 1, item->h, color);
+    span(x0 + item->w - 1, y0, 1, item->h, color);
+    break;
+
+  case DL_LINE: {
+    // bresenham's algorithm
+    int16_t x1 = item->w, y1 = item->h;
+    int16_t steep = abs(y1 - y0) > abs(x1 - x0);
+    if (steep) {
+      swap(x0, y0);
+      swap(x1, y1);
+    }
+    if (x0 > x1) {
+      swap(x0, x1);
+      swap(y0, y1);
+    }
+
+    int16_t dx = x1 - x0, dy = abs(y1 - y0);
+    int16_t err = dx / 2;
+    int16_t ystep = y0 < y1 ? 1 : -1;
+    // x0 only goes up, so stop once it's past the tile
+    int16_t end = steep ? _ty + _th : _tx + _tw;
+
+    for (; (x0<=x1) && (x0 < end); x0++) {
+      if (steep)
+	plot(y0, x0, color);
+      else
+	plot(x0, y0, color);
+      err -= dy;
+      if (err < 0) {
+	y0 += ystep;
+	err += dx;
+      }
+    }
+    break;
+  }
+
+  case DL_CIRCLE:
+  case DL_FILLCIRCLE: {
+    int16_t r = item->w;
+    int16_t f = 1 - r;
+    int16_t ddF_x = 1;
+    int16_t ddF_y = -2 * r;
+    int16_t x = 0;
+    int16_t y = r;
+
+    if (item->type == DL_FILLCIRCLE) {
+      span(x0, y0-r, 1, 2*r+1, color);
+    } else {
+      plot(x0, y0+r, color);
+      plot(x0, y0-r, color);
+      plot(x0+r, y0, color);
+      plot(x0-r, y0, color);
+    }
+
+    while (x<y) {
+      if (f >= 0) {
+	y--;
+	ddF_y += 2;
+	f += ddF_y;
+      }
+      x++;
+      ddF_x += 2;
+      f += ddF_x;
+
+      if (item->type == DL_FILLCIRCLE) {
+	span(x0+x, y0-y, 1, 2*y+1, color);
+	span(x0-x, y0-y, 1, 2*y+1, color);
+	span(x0+y, y0-x, 1, 2*x+1, color);
+	span(x0-y, y0-x, 1, 2*x+1, color);
+      } else {
+	plot(x0 + x, y0 + y, color);
+	plot(x0 - x, y0 + y, color);
+	plot(x0 + x, y0 - y, color);
+	plot(x0 - x, y0 - y, color);
+	plot(x0 + y, y0 + x, color);
+	plot(x0 - y, y0 + x, color);
+	plot(x0 + y, y0 - x, color);
+	plot(x0 - y, y0 - x, color);
+      }
+    }
+    break;
+  }
+
+  case DL_STRING: {
+    // 6x8 character cells, the 6th column is the gap to the next one
+    uint8_t size = item->size;
+    uint8_t opaque = item->bg != color;
+    const char *c = item->str;
+
+    for (; *c; c++, x0 += 6*size) {
+      if (x0 >= _tx + _tw) break;
+      if (x0 + 6*size <= _tx) continue;
+
+      for (uint8_t i = 0; i < 6; i++) {
+	uint8_t line = i < 5 ? pgm_read_byte(font + ((uint8_t)*c * 5) + i) : 0;
+
+	for (uint8_t j = 0; j < 8; j++, line >>= 1) {
+	  if (line & 0x1)
+	    span(x0 + i*size, y0 + j*size, size, size, color);
+	  else if (opaque)
+	    span(x0 + i*size, y0 + j*size, size, size, item->bg);
+	}
+      }
+    }
+    break;
+  }
+  }
+}
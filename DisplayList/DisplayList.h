@@ -0,0 +1,77 @@
+// Display list renderer for color LCDs without a frame buffer,
+// e.g. TFTLCD and ST7735
+// MIT license
+//
+// Primitives are recorded in the list instead of being drawn.
+// render() then paints them, in the order they were added, into a small
+// buffer one strip or tile of the screen at a time and sends each one
+// to the LCD through a window. So overlapping primitives don't flicker
+// and every pixel is written to the LCD once per frame.
+
+#include <WProgram.h>
+
+// pixels rendered at a time, two bytes each on the stack during render()
+#define DISPLAYLIST_BUFFER 256
+
+// primitives a list can hold, 16 bytes each
+#define DISPLAYLIST_ITEMS 16
+
+// sets the window the following pixels fill left to right, top to bottom
+typedef void (*DisplayList_WindowFunc)(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+// writes n pixels to the window
+typedef void (*DisplayList_PixelFunc)(uint16_t *pixels, uint16_t n);
+
+typedef struct {
+  uint8_t type;
+  uint8_t size;        // text size
+  int16_t x, y;
+  int16_t w, h;        // the end of a line, the radius of a circle in w
+  uint16_t color;
+  uint16_t bg;         // text background, the same as color for none
+  const char *str;     // text, must be kept until rendered
+} DisplayListItem;
+
+class DisplayList {
+ public:
+  DisplayList(uint16_t w, uint16_t h);
+
+  // empty the list, the screen is filled with color under the primitives
+  void clear(uint16_t color);
+
+  // these return false when the list is full
+  boolean fillRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+  boolean drawRect(int16_t x, int16_t y, uint16_t w, uint16_t h, uint16_t color);
+  boolean drawHorizontalLine(int16_t x, int16_t y, uint16_t length, uint16_t color);
+  boolean drawVerticalLine(int16_t x, int16_t y, uint16_t length, uint16_t color);
+  boolean drawLine(int16_t x0, int16_t y0, int16_t x1, int16_t y1, uint16_t color);
+  boolean drawCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color);
+  boolean fillCircle(int16_t x0, int16_t y0, uint16_t r, uint16_t color);
+  boolean drawString(int16_t x, int16_t y, const char *c, uint16_t color, uint8_t s = 1);
+  // with a background color different from color the character cells are filled
+  boolean drawString(int16_t x, int16_t y, const char *c, uint16_t color, uint16_t bg, uint8_t s);
+
+  uint8_t count(void);
+
+  // send the whole screen, or just a part of it, to the LCD
+  void render(DisplayList_WindowFunc window, DisplayList_PixelFunc pixels);
+  void render(int16_t x, int16_t y, uint16_t w, uint16_t h, 
+	      DisplayList_WindowFunc window, DisplayList_PixelFunc pixels);
+
+ private:
+  DisplayListItem *add(uint8_t type, int16_t x, int16_t y, int16_t w, int16_t h, 
+		       uint16_t color);
+  void paint(DisplayListItem *item);
+  void span(int16_t x, int16_t y, int16_t w, int16_t h, uint16_t color);
+  void plot(int16_t x, int16_t y, uint16_t color);
+
+  DisplayListItem items[DISPLAYLIST_ITEMS];
+  uint8_t _count;
+  uint16_t _width, _height;
+  uint16_t _bg;
+
+  // the tile being rendered
+  uint16_t *_tile;
+  int16_t _tx, _ty;
+  int16_t _tw, _th;
+};
@@ -0,0 +1,63 @@
+// Animates a box moving over a background and a label with ST7735.
+// Drawn straight to the LCD the background and the label would be
+// redrawn under the box every frame and flicker. With a display list
+// each pixel is sent to the LCD once per frame.
+
+// Pins SCLK and MOSI are fixed in hardware, and pin 10 (or 53) 
+// must be an output
+#define cs 10   // for MEGAs you probably want this to be pin 53
+#define dc 9
+#define rst 8  // you can also connect this to the Arduino reset
+
+// Color definitions
+#define	BLACK           0x0000
+#define	BLUE            0x001F
+#define	RED             0xF800
+#define YELLOW          0xFFE0  
+#define WHITE           0xFFFF
+
+#include <ST7735.h>
+#include <SPI.h>
+#include <DisplayList.h>
+
+ST7735 tft = ST7735(cs, dc, rst);    
+DisplayList dl(ST7735::width, ST7735::height);
+
+int16_t boxx = 0, boxdx = 2;
+
+// the display list sends its pixels through these
+void window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  tft.setAddrWindow(x, y, x+w-1, y+h-1);
+}
+
+void pixels(uint16_t *p, uint16_t n) {
+  tft.pushPixels(p, n);
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  tft.initR();               // initialize a ST7735R chip
+  tft.writecommand(ST7735_DISPON);
+}
+
+void loop(void) {
+  uint32_t time = millis();
+
+  dl.clear(BLUE);
+  dl.fillRect(10, 30, 108, 60, YELLOW);
+  dl.drawString(16, 56, "Display list", BLACK, 1);
+  dl.fillRect(boxx, 40, 30, 30, RED);
+  dl.drawRect(boxx, 40, 30, 30, WHITE);
+
+  // only the band with the box in it changes
+  dl.render(0, 30, tft.width, 60, window, pixels);
+
+  boxx += boxdx;
+  if ((boxx < 0) || (boxx + 30 > tft.width)) {
+    boxdx = -boxdx;
+    boxx += 2*boxdx;
+  }
+
+  Serial.print(millis() - time, DEC);
+  Serial.println(" ms per frame");
+}
@@ -0,0 +1,68 @@
+// Animates a box moving over a background and a label with TFTLCD.
+// Drawn straight to the LCD the background and the label would be
+// redrawn under the box every frame and flicker. With a display list
+// each pixel is sent to the LCD once per frame.
+
+// The control pins can connect to any pins but we'll use the 
+// analog lines since that means we can double up the pins
+// with the touch screen (see the TFT paint example)
+#define LCD_CS A3    // Chip Select goes to Analog 3
+#define LCD_CD A2    // Command/Data goes to Analog 2
+#define LCD_WR A1    // LCD Write goes to Analog 1
+#define LCD_RD A0    // LCD Read goes to Analog 0
+
+// you can also just connect RESET to the arduino RESET pin
+#define LCD_RESET A4
+
+// Color definitions
+#define	BLACK           0x0000
+#define	BLUE            0x001F
+#define	RED             0xF800
+#define YELLOW          0xFFE0 
+#define WHITE           0xFFFF
+
+#include "TFTLCD.h"
+#include "DisplayList.h"
+
+TFTLCD tft(LCD_CS, LCD_CD, LCD_WR, LCD_RD, LCD_RESET);
+DisplayList dl(TFTLCD::TFTWIDTH, TFTLCD::TFTHEIGHT);
+
+int16_t boxx = 0, boxdx = 3;
+
+// the display list sends its pixels through these
+void window(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  tft.setWindow(x, y, w, h);
+}
+
+void pixels(uint16_t *p, uint16_t n) {
+  tft.pushPixels(p, n);
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  tft.reset();
+  tft.initDisplay();
+}
+
+void loop(void) {
+  uint32_t time = millis();
+
+  dl.clear(BLUE);
+  dl.fillRect(20, 40, 200, 100, YELLOW);
+  dl.drawString(30, 80, "Display list", BLACK, 2);
+  dl.fillRect(boxx, 60, 40, 40, RED);
+  dl.drawRect(boxx, 60, 40, 40, WHITE);
+
+  // only the band with the box in it changes
+  dl.render(0, 40, tft.width(), 100, window, pixels);
+  tft.resetWindow();
+
+  boxx += boxdx;
+  if ((boxx < 0) || (boxx + 40 > tft.width())) {
+    boxdx = -boxdx;
+    boxx += 2*boxdx;
+  }
+
+  Serial.print(millis() - time, DEC);
+  Serial.println(" ms per frame");
+}
@@ -35,30 +35,31 @@ inline void ST7735::spiwrite(uint8_t c) {
     return;
   }
 
-  volatile uint8_t *sclkportreg = portOutputRegister(sclkport);
-  volatile uint8_t *sidportreg = portOutputRegister(sidport);
+  bitbang(c, portOutputRegister(sclkport), portOutputRegister(sidport));
+}
 
-  int8_t i;
+// one bit of software SPI, SCLK is left high
+#define BITBANG(bit) \
+  *sclkportreg &= ~sclkpin; \
+  if (c & _BV(bit)) \
+    *sidportreg |= sidpin; \
+  else \
+    *sidportreg &= ~sidpin; \
+  *sclkportreg |= sclkpin;
 
+// unrolled so there's no loop or shift for each bit
+inline void ST7735::bitbang(uint8_t c, volatile uint8_t *sclkportreg, 
+			    volatile uint8_t *sidportreg) {
   *sclkportreg |= sclkpin;
 
-  for (i=7; i>=0; i--) {
-    *sclkportreg &= ~sclkpin;
-    //SCLK_PORT &= ~_BV(SCLK);
-    
-    if (c & _BV(i)) {
-      *sidportreg |= sidpin;
-      //digitalWrite(_sid, HIGH);
-      //SID_PORT |= _BV(SID);
-    } else {
-      *sidportreg &= ~sidpin;
-      //digitalWrite(_sid, LOW);
-      //SID_PORT &= ~_BV(SID);
-    }
-    
-    *sclkportreg |= sclkpin;
-    //SCLK_PORT |= _BV(SCLK);
-  }
+  BITBANG(7);
+  BITBANG(6);
+  BITBANG(5);
+  BITBANG(4);
+  BITBANG(3);
+  BITBANG(2);
+  BITBANG(1);
+  BITBANG(0);
 }
 
 
@@ -92,21 +93,89 @@ void ST7735::writedata(uint8_t c) {
 } 
 
 
+// Set the window with the LCD selected the whole time, only RS
+// changes between the commands and their data.
+// The LCD is left selected ready for the pixel data.
+void ST7735::openWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
+{
+  volatile uint8_t *rsportreg = portOutputRegister(rsport);
+
+  *rsportreg &= ~ rspin;
+  *portOutputRegister(csport) &= ~ cspin;
+
+  spiwrite(ST7735_CASET);  // column addr set
+  *rsportreg |= rspin;
+  spiwrite(0x00);
+  spiwrite(x0+2);   // XSTART 
+  spiwrite(0x00);
+  spiwrite(x1+2);   // XEND
+
+  *rsportreg &= ~ rspin;
+  spiwrite(ST7735_RASET);  // row addr set
+  *rsportreg |= rspin;
+  spiwrite(0x00);
+  spiwrite(y0+1);    // YSTART
+  spiwrite(0x00);
+  spiwrite(y1+1);    // YEND
+
+  *rsportreg &= ~ rspin;
+  spiwrite(ST7735_RAMWR);  // write to RAM
+  *rsportreg |= rspin;
+}
+
 void ST7735::setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1)
 {
-  writecommand(ST7735_CASET);  // column addr set
-  writedata(0x00);
-  writedata(x0+2);   // XSTART 
-  writedata(0x00);
-  writedata(x1+2);   // XEND
+  openWindow(x0, y0, x1, y1);
+  *portOutputRegister(csport) |= cspin;
+}
 
-  writecommand(ST7735_RASET);  // row addr set
-  writedata(0x00);
-  writedata(y0+1);    // YSTART
-  writedata(0x00);
-  writedata(y1+1);    // YEND
+void ST7735::beginWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h)
+{
+  openWindow(x, y, x+w-1, y+h-1);
+}
 
-  writecommand(ST7735_RAMWR);  // write to RAM
+void ST7735::endWindow(void)
+{
+  *portOutputRegister(csport) |= cspin;
+}
+
+// write n pixels of a color between beginWindow() and endWindow()
+void ST7735::writeColor(uint16_t color, uint16_t n) {
+  uint8_t hi = color >> 8, lo = color;
+
+  if (!_sid) {
+    // hardware SPI, the bytes go back to back
+    while (n--) {
+      SPI.transfer(hi);
+      SPI.transfer(lo);
+    }
+  } else {
+    volatile uint8_t *sclkportreg = portOutputRegister(sclkport);
+    volatile uint8_t *sidportreg = portOutputRegister(sidport);
+
+    while (n--) {
+      bitbang(hi, sclkportreg, sidportreg);
+      bitbang(lo, sclkportreg, sidportreg);
+    }
+  }
+}
+
+// write pixels between beginWindow() and endWindow()
+void ST7735::writePixels(uint16_t *pixels, uint16_t n) {
+  if (!_sid) {
+    while (n--) {
+      SPI.transfer(*pixels >> 8);
+      SPI.transfer(*pixels++);
+    }
+  } else {
+    volatile uint8_t *sclkportreg = portOutputRegister(sclkport);
+    volatile uint8_t *sidportreg = portOutputRegister(sidport);
+
+    while (n--) {
+      bitbang(*pixels >> 8, sclkportreg, sidportreg);
+      bitbang(*pixels++, sclkportreg, sidportreg);
+    }
+  }
 }
 
 void ST7735::pushColor(uint16_t color) {
@@ -119,14 +188,20 @@ void ST7735::pushColor(uint16_t color) {
   *portOutputRegister(csport) |= cspin;
 }
 
+// write pixels to the window, with one chip select for all of them
+void ST7735::pushPixels(uint16_t *pixels, uint16_t n) {
+  *portOutputRegister(rsport) |= rspin;
+  *portOutputRegister(csport) &= ~ cspin;
+
+  writePixels(pixels, n);
+
+  *portOutputRegister(csport) |= cspin;
+}
+
 void ST7735::drawPixel(uint8_t x, uint8_t y,uint16_t color) {
   if ((x >= width) || (y >= height)) return;
 
-  setAddrWindow(x,y,x+1,y+1);
-
-  // setup for data
-  *portOutputRegister(rsport) |= rspin;
-  *portOutputRegister(csport) &= ~ cspin;
+  openWindow(x, y, x, y);
 
   spiwrite(color >> 8);    
   spiwrite(color);   
@@ -137,20 +212,9 @@ void ST7735::drawPixel(uint8_t x, uint8_t y,uint16_t color) {
 
 
 void ST7735::fillScreen(uint16_t color) {
-  setAddrWindow(0, 0, width-1, height-1);
-
-  // setup for data
-  *portOutputRegister(rsport) |= rspin;
-  *portOutputRegister(csport) &= ~ cspin;
-
-  for (uint8_t x=0; x < width; x++) {
-    for (uint8_t y=0; y < height; y++) {
-      spiwrite(color >> 8);    
-      spiwrite(color);    
-    }
-  }
-
-  *portOutputRegister(csport) |= cspin;
+  beginWindow(0, 0, width, height);
+  writeColor(color, (uint16_t)width * height);
+  endWindow();
 }
 
 void ST7735::initB(void) {
@@ -446,8 +510,13 @@ void ST7735::initR(void) {
 
 void ST7735::drawString(uint8_t x, uint8_t y, char *c, 
 			uint16_t color, uint8_t size) {
+  drawString(x, y, c, color, color, size);
+}
+
+void ST7735::drawString(uint8_t x, uint8_t y, char *c, 
+			uint16_t color, uint16_t bg, uint8_t size) {
   while (c[0] != 0) {
-    drawChar(x, y, c[0], color, size);
+    drawChar(x, y, c[0], color, bg, size);
     x += size*6;
     c++;
     if (x + 5 >= width) {
@@ -456,22 +525,69 @@ void ST7735::drawString(uint8_t x, uint8_t y, char *c,
     }
   }
 }
+
 // draw a character
 void ST7735::drawChar(uint8_t x, uint8_t y, char c, 
 		      uint16_t color, uint8_t size) {
-  for (uint8_t i =0; i<5; i++ ) {
-    uint8_t line = pgm_read_byte(font+(c*5)+i);
-    for (uint8_t j = 0; j<8; j++) {
-      if (line & 0x1) {
-	if (size == 1) // default size
+  drawChar(x, y, c, color, color, size);
+}
+
+// draw a character, with its background unless bg is the same as color
+void ST7735::drawChar(uint8_t x, uint8_t y, char c, 
+		      uint16_t color, uint16_t bg, uint8_t size) {
+  uint8_t line[5];
+
+  for (uint8_t i =0; i<5; i++ ) 
+    line[i] = pgm_read_byte(font+(c*5)+i);
+
+  if (bg == color) {
+    // only the glyph pixels, each run down a column drawn as one line
+    for (uint8_t i =0; i<5; i++ ) {
+      for (uint8_t j = 0; j<8; ) {
+	uint8_t n = 0;
+	while ((j+n < 8) && (line[i] & (1 << (j+n))))
+	  n++;
+	if (n == 0) {
+	  j++;
+	  continue;
+	}
+	if (size > 1)  // big size
+	  fillRect(x+i*size, y+j*size, size, n*size, color);
+	else if (n > 1)
+	  drawVerticalLine(x+i, y+j, n, color);
+	else
 	  drawPixel(x+i, y+j, color);
-	else {  // big size
-	  fillRect(x+i*size, y+j*size, size, size, color);
-	} 
+	j += n;
       }
-      line >>= 1;
     }
+    return;
   }
+
+  if ((x + 6*size > width) || (y + 8*size > height)) {
+    // partly off the screen, draw the pixels that fit one at a time
+    for (uint8_t i =0; i<6; i++ ) {
+      for (uint8_t j = 0; j<8; j++) {
+	uint16_t p = (i < 5) && (line[i] & (1 << j)) ? color : bg;
+	if (size == 1)
+	  drawPixel(x+i, y+j, p);
+	else
+	  fillRect(x+i*size, y+j*size, size, size, p);
+      }
+    }
+    return;
+  }
+
+  // the whole 6x8 cell, including the gap to the next character,
+  // is streamed into a window one row of pixels at a time
+  beginWindow(x, y, 6*size, 8*size);
+  for (uint8_t j = 0; j<8; j++) {
+    for (uint8_t r = 0; r<size; r++) {
+      for (uint8_t i = 0; i<6; i++) {
+	writeColor((i < 5) && (line[i] & (1 << j)) ? color : bg, size);
+      }
+    }
+  }
+  endWindow();
 }
 
 // fill a circle
@@ -560,35 +676,29 @@ void ST7735::drawRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h,
 
 void ST7735::fillRect(uint8_t x, uint8_t y, uint8_t w, uint8_t h, 
 		      uint16_t color) {
-  // smarter version
-
-  setAddrWindow(x, y, x+w, y+h);
-
-  // setup for data
-  digitalWrite(_rs, HIGH);
-  digitalWrite(_cs, LOW);
-
-  for (x=0; x < w; x++) {
-    for (y=0; y < h; y++) {
-      spiwrite(color >> 8);    
-      spiwrite(color);    
-    }
-  }
-  digitalWrite(_cs, HIGH);
+  if ((x >= width) || (y >= height)) return;
+  if (x+w > width) w = width-x;
+  if (y+h > height) h = height-y;
+  if ((w == 0) || (h == 0)) return;
+
+  // smarter version, the whole rectangle is one window
+  beginWindow(x, y, w, h);
+  writeColor(color, (uint16_t)w * h);
+  endWindow();
 }
 
 void ST7735::drawVerticalLine(uint8_t x, uint8_t y, uint8_t length, uint16_t color)
 {
-  if (x >= width) return;
-  if (y+length >= height) length = height-y-1;
+  if ((x >= width) || (y >= height)) return;
+  if (y+length > height) length = height-y;
 
   drawFastLine(x,y,length,color,1);
 }
 
 void ST7735::drawHorizontalLine(uint8_t x, uint8_t y, uint8_t length, uint16_t color)
 {
-  if (y >= height) return;
-  if (x+length >= width) length = width-x-1;
+  if ((x >= width) || (y >= height)) return;
+  if (x+length > width) length = width-x;
 
   drawFastLine(x,y,length,color,0);
 }
@@ -596,20 +706,15 @@ void ST7735::drawHorizontalLine(uint8_t x, uint8_t y, uint8_t length, uint16_t c
 void ST7735::drawFastLine(uint8_t x, uint8_t y, uint8_t length, 
 			  uint16_t color, uint8_t rotflag)
 {
+  if (length == 0) return;
+
   if (rotflag) {
-    setAddrWindow(x, y, x, y+length);
+    beginWindow(x, y, 1, length);
   } else {
-    setAddrWindow(x, y, x+length, y+1);
-  }
-  // setup for data
-  digitalWrite(_rs, HIGH);
-  digitalWrite(_cs, LOW);
-
-  while (length--) {
-    spiwrite(color >> 8);    
-    spiwrite(color);    
+    beginWindow(x, y, length, 1);
   }
-  digitalWrite(_cs, HIGH);
+  writeColor(color, length);
+  endWindow();
 }
 
 
@@ -62,6 +62,7 @@ class ST7735 {
 
   // drawing primitives!
   void pushColor(uint16_t color);
+  void pushPixels(uint16_t *pixels, uint16_t n);
   void drawPixel(uint8_t x, uint8_t y, uint16_t color);
   void drawLine(int16_t x, int16_t y, int16_t x1, int16_t y1, uint16_t color);
   void fillScreen(uint16_t color);
@@ -84,11 +85,24 @@ class ST7735 {
 		  uint16_t color, uint8_t size=1);
   void drawChar(uint8_t x, uint8_t y, char c, 
 		      uint16_t color, uint8_t size=1);
+  // with a background color different from color the whole character
+  // cell is drawn, which is much faster than only drawing the glyph pixels
+  void drawString(uint8_t x, uint8_t y, char *c, 
+		  uint16_t color, uint16_t bg, uint8_t size);
+  void drawChar(uint8_t x, uint8_t y, char c, 
+		      uint16_t color, uint16_t bg, uint8_t size);
 
   static const uint8_t width = 128;
   static const uint8_t height = 160;
 
   void setAddrWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
+
+  // streaming, the LCD stays selected from beginWindow() to endWindow()
+  // and the pixels fill the window left to right, top to bottom
+  void beginWindow(uint8_t x, uint8_t y, uint8_t w, uint8_t h);
+  void writeColor(uint16_t color, uint16_t n=1);
+  void writePixels(uint16_t *pixels, uint16_t n);
+  void endWindow(void);
   void setRotation(uint8_t);
   uint8_t getRotation(void);
 
@@ -105,6 +119,8 @@ class ST7735 {
 
  private:
   void spiwrite(uint8_t);
+  void bitbang(uint8_t c, volatile uint8_t *sclkportreg, volatile uint8_t *sidportreg);
+  void openWindow(uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1);
   //uint8_t spiread(void);
 
   uint8_t _cs, _rs, _rst, _sid, _sclk;
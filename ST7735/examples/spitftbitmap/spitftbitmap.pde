@@ -112,6 +112,8 @@ void bmpdraw(File f, int x, int y) {
   
   uint8_t sdbuffer[3 * BUFFPIXEL];  // 3 * pixels to buffer
   uint8_t buffidx = 3*BUFFPIXEL;
+  uint16_t lcdbuffer[BUFFPIXEL];    // converted pixels for the LCD
+  uint8_t lcdidx = 0;
   
   //Serial.print("rotation = "); Serial.println(tft.getRotation(), DEC);
   
@@ -127,6 +129,12 @@ void bmpdraw(File f, int x, int y) {
     for (j=0; j<bmpWidth; j++) {
       // read more pixels
       if (buffidx >= 3*BUFFPIXEL) {
+        // the SD card shares the SPI bus so the converted pixels
+        // are written before reading, the LCD is deselected between
+        if (lcdidx) {
+          tft.pushPixels(lcdbuffer, lcdidx);
+          lcdidx = 0;
+        }
         bmpFile.read(sdbuffer, 3*BUFFPIXEL);
         buffidx = 0;
       }
@@ -148,9 +156,12 @@ void bmpdraw(File f, int x, int y) {
      //Serial.print(p, HEX);
       // write out the 16 bits of color
       //tft.drawPixel(i, j, p);
-      tft.pushColor(p);
+      lcdbuffer[lcdidx++] = p;
     }
   }
+  // write out what's left
+  if (lcdidx)
+    tft.pushPixels(lcdbuffer, lcdidx);
   Serial.print(millis() - time, DEC);
   Serial.println(" ms");
 }
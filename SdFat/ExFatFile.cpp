@@ -0,0 +1,1090 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <ExFatFile.h>
+#if EXFAT_SUPPORT
+//------------------------------------------------------------------------------
+// up-case an ASCII character - the volume's up-case table is not used
+static inline uint8_t exUpcase(uint8_t c) {
+  return c < 'a' || c > 'z' ?  c : c + ('A' - 'a');
+}
+//------------------------------------------------------------------------------
+// add one 32 byte entry to a directory entry set checksum
+static uint16_t exSetChecksum(uint16_t sum, const uint8_t* p, bool first) {
+  for (uint8_t i = 0; i < 32; i++) {
+    // skip the checksum field of the file entry
+    if (first && (i == 2 || i == 3)) continue;
+    sum = ((sum & 1) ? 0X8000 : 0) + (sum >> 1) + p[i];
+  }
+  return sum;
+}
+//------------------------------------------------------------------------------
+// add a cluster to a file
+bool ExFatFile::addCluster() {
+  uint32_t cluster;
+  // try to allocate the cluster that follows the end of the file
+  uint32_t start = curCluster_ ? curCluster_ + 1 : vol_->allocSearchStart_;
+
+  if (!vol_->bitmapFind(start, 1, &cluster)) goto fail;
+  if (!vol_->bitmapModify(cluster, 1, true)) goto fail;
+
+  if (firstCluster_ == 0) {
+    // first cluster of file
+    firstCluster_ = cluster;
+    flags_ |= F_CONTIGUOUS;
+  } else if (isContiguous() && cluster != (curCluster_ + 1)) {
+    // file is no longer contiguous - build FAT chain for current clusters
+    for (uint32_t c = firstCluster_; c < curCluster_; c++) {
+      if (!vol_->fatPut(c, c + 1)) goto fail;
+    }
+    flags_ &= ~F_CONTIGUOUS;
+  }
+  if (!isContiguous()) {
+    // link new cluster to chain
+    if (!vol_->fatPut(curCluster_, cluster)) goto fail;
+    if (!vol_->fatPutEOC(cluster)) goto fail;
+  }
+  curCluster_ = cluster;
+  flags_ |= F_FILE_DIR_DIRTY;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// Add a cluster to a directory file and zero the cluster.
+// return with first block of cluster in the cache and the file rewound
+bool ExFatFile::addDirCluster() {
+  uint32_t block;
+
+  // position to last cluster of directory
+  if (!seekSet(fileSize_)) goto fail;
+  if (!addCluster()) goto fail;
+  if (!vol_->cacheFlush()) goto fail;
+
+  block = vol_->clusterStartBlock(curCluster_);
+
+  // set cache to first block of cluster
+  vol_->cacheSetBlockNumber(block, true);
+
+  // zero first block of cluster
+  memset(vol_->cacheBuffer_.data, 0, 512);
+
+  // zero rest of cluster
+  for (uint16_t i = 1; i < vol_->blocksPerCluster_; i++) {
+    if (!vol_->writeBlock(block + i, vol_->cacheBuffer_.data)) goto fail;
+  }
+  // Increase directory file size by cluster size
+  fileSize_ += 512UL << vol_->clusterSizeShift_;
+  validLength_ = fileSize_;
+
+  // curCluster_ is now past the old end of file
+  curCluster_ = 0;
+  curPosition_ = 0;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// cache the block for entry i of this file's directory entry set
+// return pointer to cached entry or null for failure
+uint8_t* ExFatFile::cacheSetEntry(uint8_t i, uint8_t action) {
+  uint8_t index = dirIndex_ + i;
+  if (!vol_->cacheRawBlock(dirBlock_[index >> 4], action)) goto fail;
+  return vol_->cache()->data + 32 * (index & 0XF);
+
+ fail:
+  return NULL;
+}
+//------------------------------------------------------------------------------
+/** Close a file and force cached data and directory information
+ *  to be written to the storage device.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include no file is open or an I/O error.
+ */
+bool ExFatFile::close() {
+  if (sync()) {
+    type_ = FAT_FILE_TYPE_CLOSED;
+    return true;
+  }
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Check for contiguous file and return its raw block range.
+ *
+ * \param[out] bgnBlock the first block address for the file.
+ * \param[out] endBlock the last  block address for the file.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include file is not contiguous, file has zero length
+ * or an I/O error occurred.
+ */
+bool ExFatFile::contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock) {
+  uint32_t count;
+  // error if no blocks
+  if (firstCluster_ == 0 || fileSize_ == 0) goto fail;
+
+  // number of clusters in file
+  count = ((fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+
+  if (!isContiguous()) {
+    // check FAT chain for contiguous clusters
+    for (uint32_t c = firstCluster_; c < (firstCluster_ + count - 1); c++) {
+      uint32_t next;
+      if (!vol_->fatGet(c, &next)) goto fail;
+      if (next != (c + 1)) goto fail;
+    }
+  }
+  *bgnBlock = vol_->clusterStartBlock(firstCluster_);
+  *endBlock = vol_->clusterStartBlock(firstCluster_ + count - 1)
+              + vol_->blocksPerCluster_ - 1;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// create a directory entry set for name at position pos in dirFile
+bool ExFatFile::create(ExFatFile* dirFile, uint32_t pos,
+  const char* name, uint8_t len, uint8_t oflag) {
+  // stream extension plus name entries
+  uint8_t count = 1 + (len + EXFAT_NAME_PER_ENTRY - 1)/EXFAT_NAME_PER_ENTRY;
+  uint16_t hash = nameHash(name, len);
+  uint32_t now = timestamp();
+
+  // add clusters to dirFile until the entry set fits
+  while (((dirFile->fileSize_ - pos) >> 5) <= count) {
+    if (!dirFile->addDirCluster()) goto fail;
+    if (!dirFile->sync()) goto fail;
+  }
+  if (!dirFile->seekSet(pos)) goto fail;
+
+  dirIndex_ = (pos >> 5) & 0XF;
+  for (uint8_t i = 0; i <= count; i++) {
+    uint8_t* p = dirFile->readDirCache();
+    if (!p) goto fail;
+    vol_->cacheSetDirty();
+    dirBlock_[(dirIndex_ + i) >> 4] = vol_->cacheBlockNumber();
+    memset(p, 0, 32);
+    if (i == 0) {
+      exfat_file_t* f = reinterpret_cast<exfat_file_t*>(p);
+      f->type = EXFAT_TYPE_FILE;
+      f->secondaryCount = count;
+      f->attributes = EXFAT_ATTRIB_ARCHIVE;
+      f->createTimestamp = now;
+      f->modifyTimestamp = now;
+      f->accessTimestamp = now;
+    } else if (i == 1) {
+      exfat_stream_t* s = reinterpret_cast<exfat_stream_t*>(p);
+      s->type = EXFAT_TYPE_STREAM;
+      s->flags = EXFAT_FLAG_ALLOC_POSSIBLE;
+      s->nameLength = len;
+      s->nameHash = hash;
+    } else {
+      exfat_name_t* n = reinterpret_cast<exfat_name_t*>(p);
+      n->type = EXFAT_TYPE_NAME;
+      for (uint8_t j = 0; j < EXFAT_NAME_PER_ENTRY && len; j++, len--) {
+        n->name[j] = *name++;
+      }
+    }
+  }
+  // initialize as empty file
+  setCount_ = count;
+  attributes_ = EXFAT_ATTRIB_ARCHIVE;
+  firstCluster_ = 0;
+  fileSize_ = 0;
+  validLength_ = 0;
+  curCluster_ = 0;
+  curPosition_ = 0;
+  type_ = FAT_FILE_TYPE_NORMAL;
+  flags_ = (oflag & F_OFLAG) | F_CONTIGUOUS | F_FILE_DIR_DIRTY;
+
+  // write entry set with checksum to SD
+  return sync();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// free count clusters starting at cluster
+bool ExFatFile::freeClusters(uint32_t cluster, uint32_t count) {
+  if (isContiguous()) return vol_->bitmapModify(cluster, count, false);
+
+  while (count--) {
+    uint32_t next;
+    if (!vol_->fatGet(cluster, &next)) goto fail;
+    if (!vol_->bitmapModify(cluster, 1, false)) goto fail;
+    cluster = next;
+  }
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Get a file's name
+ *
+ * Characters that are not ASCII are returned as '?'.
+ *
+ * \param[out] name An array for the file's name.
+ * \param[in] size The size of the array.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool ExFatFile::getName(char* name, uint16_t size) {
+  uint8_t* p;
+  uint8_t len;
+  uint8_t k = 0;
+  if (!isOpen() || size < 2) goto fail;
+
+  if (isRoot()) {
+    name[0] = '/';
+    name[1] = '\0';
+    return true;
+  }
+  p = cacheSetEntry(1, SdVolume::CACHE_FOR_READ);
+  if (!p) goto fail;
+  len = reinterpret_cast<exfat_stream_t*>(p)->nameLength;
+
+  for (uint8_t i = 2; i <= setCount_ && k < len; i++) {
+    p = cacheSetEntry(i, SdVolume::CACHE_FOR_READ);
+    if (!p) goto fail;
+    exfat_name_t* n = reinterpret_cast<exfat_name_t*>(p);
+    for (uint8_t j = 0; j < EXFAT_NAME_PER_ENTRY && k < len; j++, k++) {
+      if ((k + 1U) >= size) goto fail;
+      name[k] = n->name[j] < 0X80 ? n->name[j] : '?';
+    }
+  }
+  name[k] = '\0';
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Make a new directory.
+ *
+ * \param[in] parent An open ExFatFile instance for the directory that will
+ * contain the new directory.
+ *
+ * \param[in] path A path with a valid name for the new directory.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include this ExFatFile is already open, \a parent is not
+ * a directory, \a path is invalid or already exists in \a parent.
+ */
+bool ExFatFile::mkdir(ExFatFile* parent, const char* path) {
+  ExFatFile dir1, dir2;
+  ExFatFile* start = parent;
+  ExFatFile* sub = &dir1;
+  const char* name;
+  uint8_t len;
+
+  if (!parent || isOpen()) goto fail;
+
+  if (*path == '/') {
+    while (*path == '/') path++;
+    if (!parent->isRoot()) {
+      if (!dir2.openRoot(parent->vol_)) goto fail;
+      parent = &dir2;
+    }
+  }
+  while (1) {
+    name = path;
+    if (!parseName(path, &len, &path)) goto fail;
+    while (*path == '/') path++;
+    if (!*path) break;
+    if (!sub->open(parent, name, len, O_READ)) goto fail;
+    if (parent != start) parent->close();
+    parent = sub;
+    sub = parent != &dir1 ? &dir1 : &dir2;
+  }
+  // create a normal file
+  if (!open(parent, name, len, O_CREAT | O_EXCL | O_RDWR)) goto fail;
+
+  // convert file to directory
+  flags_ = O_READ;
+  type_ = FAT_FILE_TYPE_SUBDIR;
+  attributes_ = EXFAT_ATTRIB_DIRECTORY;
+
+  // allocate and zero first cluster
+  if (!addDirCluster()) goto fail;
+
+  // force entry set to SD
+  return sync();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// exFAT name hash of the up-cased name
+uint16_t ExFatFile::nameHash(const char* name, uint8_t len) {
+  uint16_t hash = 0;
+  while (len--) {
+    hash = ((hash & 1) ? 0X8000 : 0) + (hash >> 1) + exUpcase(*name++);
+    // high byte of an ASCII UTF-16 character is zero
+    hash = ((hash & 1) ? 0X8000 : 0) + (hash >> 1);
+  }
+  return hash;
+}
+//------------------------------------------------------------------------------
+// set curCluster_ to the cluster that starts at curPosition_
+bool ExFatFile::nextCluster() {
+  if (curPosition_ == 0) {
+    // use first cluster in file
+    curCluster_ = firstCluster_;
+  } else if (isContiguous()) {
+    curCluster_++;
+  } else {
+    // get next cluster from FAT
+    if (!vol_->fatGet(curCluster_, &curCluster_)) goto fail;
+  }
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Open a file or directory by name.
+ *
+ * \param[in] dirFile An open ExFatFile instance for the directory containing
+ * the file to be opened.
+ *
+ * \param[in] path A path with a valid exFAT name for a file to be opened.
+ *
+ * \param[in] oflag Values for \a oflag are constructed by a bitwise-inclusive
+ * OR of open flags. see SdFile::open(SdFile*, const char*, uint8_t).
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include this ExFatFile is already open, \a dirFile is
+ * not a directory, \a path is invalid, the file does not exist
+ * or can't be opened in the access mode specified by oflag.
+ */
+bool ExFatFile::open(ExFatFile* dirFile, const char* path, uint8_t oflag) {
+  ExFatFile dir1, dir2;
+  ExFatFile* parent = dirFile;
+  ExFatFile* sub = &dir1;
+  const char* name;
+  uint8_t len;
+
+  if (!dirFile) goto fail;
+
+  // error if already open
+  if (isOpen()) goto fail;
+
+  if (*path == '/') {
+    while (*path == '/') path++;
+    if (!dirFile->isRoot()) {
+      if (!dir2.openRoot(dirFile->vol_)) goto fail;
+      parent = &dir2;
+    }
+  }
+  while (1) {
+    name = path;
+    if (!parseName(path, &len, &path)) goto fail;
+    while (*path == '/') path++;
+    if (!*path) break;
+    if (!sub->open(parent, name, len, O_READ)) goto fail;
+    if (parent != dirFile) parent->close();
+    parent = sub;
+    sub = parent != &dir1 ? &dir1 : &dir2;
+  }
+  return open(parent, name, len, oflag);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// open with name of length len in dirFile
+bool ExFatFile::open(ExFatFile* dirFile, const char* name,
+  uint8_t len, uint8_t oflag) {
+  // entries needed for a new file - file, stream extension and names
+  uint8_t need = 2 + (len + EXFAT_NAME_PER_ENTRY - 1)/EXFAT_NAME_PER_ENTRY;
+  uint16_t hash = nameHash(name, len);
+  // free entries found at freePos
+  uint8_t nFree = 0;
+  uint32_t freePos = 0;
+
+  if (!dirFile->isDir() || isOpen()) goto fail;
+
+  vol_ = dirFile->vol_;
+
+  dirFile->rewind();
+  // search for file
+  while (dirFile->curPosition_ < dirFile->fileSize_) {
+    uint32_t pos = dirFile->curPosition_;
+    uint8_t* p = dirFile->readDirCache();
+    if (!p) goto fail;
+
+    if (!(p[0] & EXFAT_TYPE_IN_USE)) {
+      // remember first group of free entries large enough for the file
+      if (nFree == 0) freePos = pos;
+      if (p[0] == EXFAT_TYPE_END_OF_DIR) {
+        // all entries that follow are free
+        if (nFree < need) {
+          uint32_t left = (dirFile->fileSize_ - pos) >> 5;
+          nFree = left < (uint32_t)(need - nFree) ? nFree + left : need;
+        }
+        break;
+      }
+      if (nFree < need) nFree++;
+      continue;
+    }
+    if (nFree < need) nFree = 0;
+    if (p[0] != EXFAT_TYPE_FILE) continue;
+
+    int8_t rtn = openSet(dirFile, p, name, len, hash, oflag);
+    if (rtn < 0) goto fail;
+    if (rtn) return true;
+  }
+  // don't create unless O_CREAT and O_WRITE
+  if (!(oflag & O_CREAT) || !(oflag & O_WRITE)) goto fail;
+
+  // use end of directory if no free group found
+  if (nFree == 0) freePos = dirFile->fileSize_;
+
+  return create(dirFile, freePos, name, len, oflag);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Open the next file or subdirectory in a directory.
+ *
+ * \param[in] dirFile An open ExFatFile instance for the directory containing
+ * the file to be opened.
+ *
+ * \param[in] oflag Values for \a oflag are constructed by a bitwise-inclusive
+ * OR of flags O_READ, O_WRITE, O_TRUNC, and O_SYNC.
+ *
+ * \return true for success or false for failure.
+ */
+bool ExFatFile::openNext(ExFatFile* dirFile, uint8_t oflag) {
+  if (!dirFile || isOpen() || (dirFile->curPosition_ & 0X1F)) goto fail;
+
+  vol_ = dirFile->vol_;
+
+  while (dirFile->curPosition_ < dirFile->fileSize_) {
+    uint8_t* p = dirFile->readDirCache();
+    if (!p) goto fail;
+
+    // done if last entry
+    if (p[0] == EXFAT_TYPE_END_OF_DIR) break;
+
+    if (p[0] != EXFAT_TYPE_FILE) continue;
+
+    int8_t rtn = openSet(dirFile, p, 0, 0, 0, oflag);
+    if (rtn < 0) goto fail;
+    if (rtn) return true;
+  }
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Open a volume's root directory.
+ *
+ * \param[in] vol The exFAT volume containing the root directory to be opened.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the ExFatFile is already open or the volume
+ * is not an exFAT volume.
+ */
+bool ExFatFile::openRoot(SdVolume* vol) {
+  // error if file is already open
+  if (isOpen() || vol->fatType() != FAT_TYPE_EXFAT) goto fail;
+
+  firstCluster_ = vol->rootDirStart();
+  if (!vol->chainSize(firstCluster_, &fileSize_)) goto fail;
+  validLength_ = fileSize_;
+  vol_ = vol;
+  type_ = FAT_FILE_TYPE_ROOT32;
+  attributes_ = EXFAT_ATTRIB_DIRECTORY;
+
+  // read only and the root directory always uses the FAT
+  flags_ = O_READ;
+
+  // set to start of file
+  curCluster_ = 0;
+  curPosition_ = 0;
+
+  // root has no directory entry set
+  setCount_ = 0;
+  dirIndex_ = 0;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// Open the directory entry set that starts with the file entry at p.
+// dirFile is positioned after the file entry.
+// Return 1 if the set is for name, or any name if name is null, 0 if the set
+// is for another file or -1 for an error.
+int8_t ExFatFile::openSet(ExFatFile* dirFile, uint8_t* p,
+  const char* name, uint8_t len, uint16_t hash, uint8_t oflag) {
+  exfat_stream_t* s;
+  uint8_t count = reinterpret_cast<exfat_file_t*>(p)->secondaryCount;
+  uint8_t attributes = reinterpret_cast<exfat_file_t*>(p)->attributes;
+  uint8_t flags;
+  uint8_t k = 0;
+
+  // remember location of file entry
+  dirIndex_ = ((dirFile->curPosition_ - 32) >> 5) & 0XF;
+  dirBlock_[0] = vol_->cacheBlockNumber();
+
+  // need stream extension and at least one name entry
+  if (count < 2 || count > 18) return 0;
+
+  // read stream extension
+  p = dirFile->readDirCache();
+  if (!p) return -1;
+  dirBlock_[(dirIndex_ + 1) >> 4] = vol_->cacheBlockNumber();
+  s = reinterpret_cast<exfat_stream_t*>(p);
+  if (s->type != EXFAT_TYPE_STREAM) return 0;
+  if (name && (s->nameLength != len || s->nameHash != hash)) return 0;
+
+  // files larger than 4 GB are not supported
+  if (s->dataLength > 0XFFFFFFFF) return 0;
+  flags = s->flags;
+  firstCluster_ = s->firstCluster;
+  fileSize_ = s->dataLength;
+  validLength_ = s->validDataLength;
+
+  // compare name and find blocks for rest of set
+  for (uint8_t i = 2; i <= count; i++) {
+    p = dirFile->readDirCache();
+    if (!p) return -1;
+    dirBlock_[(dirIndex_ + i) >> 4] = vol_->cacheBlockNumber();
+    exfat_name_t* n = reinterpret_cast<exfat_name_t*>(p);
+    if (!name || n->type != EXFAT_TYPE_NAME) continue;
+    for (uint8_t j = 0; j < EXFAT_NAME_PER_ENTRY && k < len; j++, k++) {
+      if (n->name[j] > 0X7F) return 0;
+      if (exUpcase(n->name[j]) != exUpcase(name[k])) return 0;
+    }
+  }
+  if (name) {
+    if (k != len) return 0;
+    // don't open existing file if O_EXCL
+    if (oflag & O_EXCL) return -1;
+  }
+  // write or truncate is an error for a directory or read-only file
+  if (attributes & (EXFAT_ATTRIB_READ_ONLY | EXFAT_ATTRIB_DIRECTORY)) {
+    if (oflag & (O_WRITE | O_TRUNC)) return -1;
+  }
+  setCount_ = count;
+  attributes_ = attributes;
+  type_ = attributes & EXFAT_ATTRIB_DIRECTORY ?
+          FAT_FILE_TYPE_SUBDIR : FAT_FILE_TYPE_NORMAL;
+
+  // save open flags for read/write
+  flags_ = oflag & F_OFLAG;
+  if (flags & EXFAT_FLAG_NO_FAT_CHAIN) flags_ |= F_CONTIGUOUS;
+
+  // set to start of file
+  curCluster_ = 0;
+  curPosition_ = 0;
+  if ((oflag & O_TRUNC) && !truncate(0)) return -1;
+  if (oflag & O_AT_END) return seekEnd(0) ? 1 : -1;
+  return 1;
+}
+//------------------------------------------------------------------------------
+// check a path component and return its length
+bool ExFatFile::parseName(const char* path, uint8_t* len, const char** ptr) {
+  uint16_t n = 0;
+  while (*path != '\0' && *path != '/') {
+    uint8_t c = *path++;
+    // illegal exFAT characters
+    PGM_P p = PSTR("\"*:<>?\\|");
+    uint8_t b;
+    while ((b = pgm_read_byte(p++))) if (b == c) goto fail;
+    // only allow ASCII printable characters
+    if (c < 0X20 || c > 0X7E) goto fail;
+    if (++n > EXFAT_MAX_NAME_LENGTH) goto fail;
+  }
+  *len = n;
+  *ptr = path;
+  return n != 0;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Allocate contiguous clusters for an empty file.
+ *
+ * The clusters are allocated with a single bitmap search and the FAT is not
+ * used so the file can be written with Sd2Card multiple block writes
+ * after calling contiguousRange().
+ *
+ * fileSize() is set to \a length.  validLength() is not changed.  Call
+ * truncate() to free unused clusters.
+ *
+ * \param[in] length The desired file size.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the file is not empty, is not open for write,
+ * there is not enough contiguous free space or an I/O error occurs.
+ */
+bool ExFatFile::preAllocate(uint32_t length) {
+  uint32_t count;
+  uint32_t cluster;
+  if (!isFile() || !(flags_ & O_WRITE) || firstCluster_ || length == 0) {
+    goto fail;
+  }
+  count = ((length - 1) >> (vol_->clusterSizeShift_ + 9)) + 1;
+  if (!vol_->bitmapFind(vol_->allocSearchStart_, count, &cluster)) goto fail;
+  if (!vol_->bitmapModify(cluster, count, true)) goto fail;
+
+  firstCluster_ = cluster;
+  fileSize_ = length;
+  flags_ |= F_CONTIGUOUS | F_FILE_DIR_DIRTY;
+  return sync();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Read the next byte from a file.
+ *
+ * \return For success read returns the next byte in the file as an int.
+ * If an error occurs or end of file is reached -1 is returned.
+ */
+int16_t ExFatFile::read() {
+  uint8_t b;
+  return read(&b, 1) == 1 ? b : -1;
+}
+//------------------------------------------------------------------------------
+/** Read data from a file starting at the current position.
+ *
+ * \param[out] buf Pointer to the location that will receive the data.
+ *
+ * \param[in] nbyte Maximum number of bytes to read.
+ *
+ * \return For success read() returns the number of bytes read.
+ * A value less than \a nbyte, including zero, will be returned
+ * if validLength() is reached.
+ * If an error occurs, read() returns -1.
+ */
+int16_t ExFatFile::read(void* buf, uint16_t nbyte) {
+  uint8_t* dst = reinterpret_cast<uint8_t*>(buf);
+  uint16_t offset;
+  uint16_t toRead;
+  uint32_t block;  // raw device block number
+
+  // error if not open or write only
+  if (!isOpen() || !(flags_ & O_READ)) goto fail;
+
+  // max bytes left in file - data past valid length has not been written
+  if (curPosition_ >= validLength_) {
+    nbyte = 0;
+  } else if (nbyte >= (validLength_ - curPosition_)) {
+    nbyte = validLength_ - curPosition_;
+  }
+  // amount left to read
+  toRead = nbyte;
+  while (toRead > 0) {
+    offset = curPosition_ & 0X1FF;  // offset in block
+    uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    if (offset == 0 && blockOfCluster == 0) {
+      // start of new cluster
+      if (!nextCluster()) goto fail;
+    }
+    block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+    uint16_t n = toRead;
+
+    // amount to be read from current block
+    if (n > (512 - offset)) n = 512 - offset;
+
+    // no buffering needed if n == 512
+    if (n == 512 && block != vol_->cacheBlockNumber()) {
+      if (!vol_->readBlock(block, dst)) goto fail;
+    } else {
+      // read block to cache and copy data to caller
+      if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_READ)) goto fail;
+      uint8_t* src = vol_->cache()->data + offset;
+      memcpy(dst, src, n);
+    }
+    dst += n;
+    curPosition_ += n;
+    toRead -= n;
+  }
+  return nbyte;
+
+ fail:
+  return -1;
+}
+//------------------------------------------------------------------------------
+// Read next directory entry into the cache
+// Assumes file is correctly positioned
+uint8_t* ExFatFile::readDirCache() {
+  uint8_t i;
+  // error if not directory
+  if (!isDir()) goto fail;
+
+  // index of entry in cache
+  i = (curPosition_ >> 5) & 0XF;
+
+  // use read to locate and cache block
+  if (read() < 0) goto fail;
+
+  // advance to next entry
+  curPosition_ += 31;
+
+  // return pointer to entry
+  return vol_->cache()->data + 32 * i;
+
+ fail:
+  return NULL;
+}
+//------------------------------------------------------------------------------
+/** Remove a file.
+ *
+ * The directory entry set and all clusters for the file are freed.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the file read-only, is a directory,
+ * or an I/O error occurred.
+ */
+bool ExFatFile::remove() {
+  // free any clusters - will fail if read-only or directory
+  if (!truncate(0)) goto fail;
+
+  // mark all entries of the set not in use
+  for (uint8_t i = 0; i <= setCount_; i++) {
+    uint8_t* p = cacheSetEntry(i, SdVolume::CACHE_FOR_WRITE);
+    if (!p) goto fail;
+    p[0] &= ~EXFAT_TYPE_IN_USE;
+  }
+  // set this ExFatFile closed
+  type_ = FAT_FILE_TYPE_CLOSED;
+
+  // write entries to SD
+  return vol_->cacheFlush();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Sets a file's position.
+ *
+ * \param[in] pos The new position in bytes from the beginning of the file.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool ExFatFile::seekSet(uint32_t pos) {
+  uint32_t nCur;
+  uint32_t nNew;
+  // error if file not open or seek past end of file
+  if (!isOpen() || pos > fileSize_) goto fail;
+
+  if (pos == 0) {
+    // set position to start of file
+    curCluster_ = 0;
+    curPosition_ = 0;
+    goto done;
+  }
+  // calculate cluster index for new position
+  nNew = (pos - 1) >> (vol_->clusterSizeShift_ + 9);
+
+  if (isContiguous()) {
+    // no need to follow the FAT chain
+    curCluster_ = firstCluster_ + nNew;
+    curPosition_ = pos;
+    goto done;
+  }
+  // calculate cluster index for cur position
+  nCur = (curPosition_ - 1) >> (vol_->clusterSizeShift_ + 9);
+
+  if (nNew < nCur || curPosition_ == 0) {
+    // must follow chain from first cluster
+    curCluster_ = firstCluster_;
+  } else {
+    // advance from curPosition
+    nNew -= nCur;
+  }
+  while (nNew--) {
+    if (!vol_->fatGet(curCluster_, &curCluster_)) goto fail;
+  }
+  curPosition_ = pos;
+
+ done:
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** The sync() call causes all modified data and directory fields
+ * to be written to the storage device.
+ *
+ * The set checksum is recomputed when the directory entry set is updated.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include a call to sync() before a file has been
+ * opened or an I/O error.
+ */
+bool ExFatFile::sync() {
+  // only allow open files and directories
+  if (!isOpen()) goto fail;
+
+  if ((flags_ & F_FILE_DIR_DIRTY) && !isRoot()) {
+    uint16_t checksum = 0;
+    uint8_t* p;
+    for (uint8_t i = 0; i <= setCount_; i++) {
+      // only the file and stream extension entries are modified
+      p = cacheSetEntry(i, i < 2 ? SdVolume::CACHE_FOR_WRITE
+                                 : SdVolume::CACHE_FOR_READ);
+      if (!p) goto fail;
+      if (i == 0) {
+        exfat_file_t* f = reinterpret_cast<exfat_file_t*>(p);
+        // check for deleted by another open ExFatFile object
+        if (f->type != EXFAT_TYPE_FILE) goto fail;
+        f->attributes = attributes_;
+        // set modify time if user supplied a callback date/time function
+        if (SdFile::dateTime_) {
+          f->modifyTimestamp = timestamp();
+          f->accessTimestamp = f->modifyTimestamp;
+          f->modify10ms = 0;
+        }
+      } else if (i == 1) {
+        exfat_stream_t* s = reinterpret_cast<exfat_stream_t*>(p);
+        s->flags = EXFAT_FLAG_ALLOC_POSSIBLE;
+        if (isContiguous() && firstCluster_) {
+          s->flags |= EXFAT_FLAG_NO_FAT_CHAIN;
+        }
+        s->firstCluster = firstCluster_;
+        s->dataLength = fileSize_;
+        s->validDataLength = validLength_;
+      }
+      checksum = exSetChecksum(checksum, p, i == 0);
+    }
+    // store checksum in file entry
+    p = cacheSetEntry(0, SdVolume::CACHE_FOR_WRITE);
+    if (!p) goto fail;
+    reinterpret_cast<exfat_file_t*>(p)->setChecksum = checksum;
+  }
+  // clear directory dirty
+  flags_ &= ~F_FILE_DIR_DIRTY;
+  return vol_->cacheFlush();
+
+ fail:
+  writeError = true;
+  return false;
+}
+//------------------------------------------------------------------------------
+// exFAT timestamp from the SdFile date/time callback
+uint32_t ExFatFile::timestamp() {
+  uint16_t date = FAT_DEFAULT_DATE;
+  uint16_t time = FAT_DEFAULT_TIME;
+  if (SdFile::dateTime_) SdFile::dateTime_(&date, &time);
+  return (uint32_t)date << 16 | time;
+}
+//------------------------------------------------------------------------------
+/** Truncate a file to a specified length.  The current file position
+ * will be maintained if it is less than or equal to \a length otherwise
+ * it will be set to end of file.
+ *
+ * \param[in] length The desired length for the file.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include file is read only, file is a directory,
+ * \a length is greater than the current file size or an I/O error occurs.
+ */
+bool ExFatFile::truncate(uint32_t length) {
+  uint32_t newPos;
+  uint32_t keep;
+  uint32_t count;
+  uint8_t shift;
+  // error if not a normal file or read-only
+  if (!isFile() || !(flags_ & O_WRITE)) goto fail;
+
+  // error if length is greater than current size
+  if (length > fileSize_) goto fail;
+
+  // fileSize and length are zero - nothing to do
+  if (fileSize_ == 0) return true;
+
+  // remember position for seek after truncation
+  newPos = curPosition_ > length ? length : curPosition_;
+
+  // clusters to keep and clusters to free
+  shift = vol_->clusterSizeShift_ + 9;
+  keep = length ? ((length - 1) >> shift) + 1 : 0;
+  count = ((fileSize_ - 1) >> shift) + 1 - keep;
+
+  if (count) {
+    uint32_t toFree;
+    if (keep == 0) {
+      toFree = firstCluster_;
+    } else if (isContiguous()) {
+      toFree = firstCluster_ + keep;
+    } else {
+      // position to last cluster in truncated file
+      if (!seekSet(length)) goto fail;
+      if (!vol_->fatGet(curCluster_, &toFree)) goto fail;
+      // current cluster is end of chain
+      if (!vol_->fatPutEOC(curCluster_)) goto fail;
+    }
+    if (!freeClusters(toFree, count)) goto fail;
+  }
+  if (keep == 0) firstCluster_ = 0;
+  fileSize_ = length;
+  if (validLength_ > length) validLength_ = length;
+
+  // need to update directory entry set
+  flags_ |= F_FILE_DIR_DIRTY;
+
+  if (!sync()) goto fail;
+
+  // set file to correct position
+  return seekSet(newPos);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Write data to an open file.
+ *
+ * \note Data is moved to the cache but may not be written to the
+ * storage device until sync() is called.
+ *
+ * \param[in] buf Pointer to the location of the data to be written.
+ *
+ * \param[in] nbyte Number of bytes to write.
+ *
+ * \return For success write() returns the number of bytes written, always
+ * \a nbyte.  If an error occurs, write() returns -1.  Possible errors
+ * include write() is called before a file has been opened, write is called
+ * for a read-only file, device is full, a corrupt file system or an I/O error.
+ *
+ */
+int16_t ExFatFile::write(const void* buf, uint16_t nbyte) {
+  // convert void* to uint8_t*  -  must be before goto statements
+  const uint8_t* src = reinterpret_cast<const uint8_t*>(buf);
+
+  // number of bytes left to write  -  must be before goto statements
+  uint16_t nToWrite = nbyte;
+
+  // clusters allocated to the file before this write
+  uint32_t nAlloc;
+
+  // error if not a normal file or is read-only
+  if (!isFile() || !(flags_ & O_WRITE)) goto fail;
+
+  // seek to end of written data if append flag
+  if ((flags_ & O_APPEND) && curPosition_ != validLength_) {
+    if (!seekSet(validLength_)) goto fail;
+  }
+  nAlloc = fileSize_ ? ((fileSize_ - 1) >> (vol_->clusterSizeShift_ + 9)) + 1
+                     : 0;
+
+  while (nToWrite > 0) {
+    uint8_t blockOfCluster = vol_->blockOfCluster(curPosition_);
+    uint16_t blockOffset = curPosition_ & 0X1FF;
+    if (blockOfCluster == 0 && blockOffset == 0) {
+      // start of new cluster
+      if ((curPosition_ >> (vol_->clusterSizeShift_ + 9)) < nAlloc) {
+        if (!nextCluster()) goto fail;
+      } else {
+        // add cluster if at end of allocation
+        if (!addCluster()) goto fail;
+      }
+    }
+    // max space in block
+    uint16_t n = 512 - blockOffset;
+
+    // lesser of space and amount to write
+    if (n > nToWrite) n = nToWrite;
+
+    // block for data write
+    uint32_t block = vol_->clusterStartBlock(curCluster_) + blockOfCluster;
+    if (n == 512) {
+      // full block - don't need to use cache
+      if (vol_->cacheBlockNumber() == block) {
+        // invalidate cache if block is in cache
+        vol_->cacheSetBlockNumber(0XFFFFFFFF, false);
+      }
+      if (!vol_->writeBlock(block, src)) goto fail;
+    } else {
+      if (blockOffset == 0 && curPosition_ >= validLength_) {
+        // start of new block don't need to read into cache
+        if (!vol_->cacheFlush()) goto fail;
+        // set cache dirty and SD address of block
+        vol_->cacheSetBlockNumber(block, true);
+      } else {
+        // rewrite part of block
+        if (!vol_->cacheRawBlock(block, SdVolume::CACHE_FOR_WRITE)) goto fail;
+      }
+      uint8_t* dst = vol_->cache()->data + blockOffset;
+      memcpy(dst, src, n);
+    }
+    curPosition_ += n;
+    src += n;
+    nToWrite -= n;
+  }
+  if (curPosition_ > validLength_) {
+    // update sizes and insure sync will update dir entry set
+    validLength_ = curPosition_;
+    if (validLength_ > fileSize_) fileSize_ = validLength_;
+    flags_ |= F_FILE_DIR_DIRTY;
+  } else if (SdFile::dateTime_ && nbyte) {
+    // insure sync will update modified date and time
+    flags_ |= F_FILE_DIR_DIRTY;
+  }
+
+  if (flags_ & O_SYNC) {
+    if (!sync()) goto fail;
+  }
+  return nbyte;
+
+ fail:
+  // return for write error
+  writeError = true;
+  return -1;
+}
+//------------------------------------------------------------------------------
+/** Write a byte to a file. Required by the Arduino Print class.
+ * \param[in] b the byte to be written.
+ * Use ExFatFile::writeError to check for errors.
+ */
+void ExFatFile::write(uint8_t b) {
+  write(&b, 1);
+}
+//------------------------------------------------------------------------------
+/** Write a string to a file. Used by the Arduino Print class.
+ * \param[in] str Pointer to the string.
+ * Use ExFatFile::writeError to check for errors.
+ */
+void ExFatFile::write(const char* str) {
+  write(str, strlen(str));
+}
+#endif  // EXFAT_SUPPORT
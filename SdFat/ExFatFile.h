@@ -0,0 +1,157 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef ExFatFile_h
+#define ExFatFile_h
+/**
+ * \file
+ * \brief ExFatFile class
+ */
+#include <SdFile.h>
+#if EXFAT_SUPPORT
+//------------------------------------------------------------------------------
+/** Maximum length of an exFAT file name */
+uint8_t const EXFAT_MAX_NAME_LENGTH = 255;
+//------------------------------------------------------------------------------
+/**
+ * \class ExFatFile
+ * \brief Access files on exFAT volumes.
+ *
+ * ExFatFile uses the volume's allocation bitmap to allocate clusters.  A file
+ * stays contiguous, with the FAT chain unused, until a cluster can't be
+ * allocated next to the end of the file.  The file is then converted to a
+ * FAT chain.  Use preAllocate() to create large contiguous files for
+ * streaming.
+ *
+ * File names are matched with ASCII case folding.  Names are limited to
+ * printable ASCII characters.  Files larger than 4 GB are not supported.
+ */
+#if USE_PRINT
+class ExFatFile : public Print {
+#else  // USE_PRINT
+class ExFatFile {
+#endif  // USE_PRINT
+ public:
+  /** Create an instance of ExFatFile. */
+  ExFatFile() : writeError(false), type_(FAT_FILE_TYPE_CLOSED) {}
+  ~ExFatFile() {if (isOpen()) close();}
+  /**
+   * writeError is set to true if an error occurs during a write().
+   * Set writeError to false before calling print() and/or write() and check
+   * for true after calls to print() and/or write().
+   */
+  bool writeError;
+  bool close();
+  bool contiguousRange(uint32_t* bgnBlock, uint32_t* endBlock);
+  /** \return The current cluster number for a file or directory. */
+  uint32_t curCluster() const {return curCluster_;}
+  /** \return The current position for a file or directory. */
+  uint32_t curPosition() const {return curPosition_;}
+  /** \return The total number of bytes in a file or directory. */
+  uint32_t fileSize() const {return fileSize_;}
+  /** \return The first cluster number for a file or directory. */
+  uint32_t firstCluster() const {return firstCluster_;}
+  bool getName(char* name, uint16_t size);
+  /** \return True if the file's clusters are contiguous and the FAT
+   * chain is not used. */
+  bool isContiguous() const {return flags_ & F_CONTIGUOUS;}
+  /** \return True if this is a ExFatFile for a directory else false. */
+  bool isDir() const {return type_ >= FAT_FILE_TYPE_MIN_DIR;}
+  /** \return True if this is a ExFatFile for a file else false. */
+  bool isFile() const {return type_ == FAT_FILE_TYPE_NORMAL;}
+  /** \return True if this is a ExFatFile for an open file/directory. */
+  bool isOpen() const {return type_ != FAT_FILE_TYPE_CLOSED;}
+  /** \return True if this is a ExFatFile for the root directory. */
+  bool isRoot() const {return type_ == FAT_FILE_TYPE_ROOT32;}
+  /** \return True if this is a ExFatFile for a subdirectory else false. */
+  bool isSubDir() const {return type_ == FAT_FILE_TYPE_SUBDIR;}
+  bool mkdir(ExFatFile* parent, const char* path);
+  bool open(ExFatFile* dirFile, const char* path, uint8_t oflag);
+  bool openNext(ExFatFile* dirFile, uint8_t oflag = O_READ);
+  bool openRoot(SdVolume* vol);
+  bool preAllocate(uint32_t length);
+  int16_t read();
+  int16_t read(void* buf, uint16_t nbyte);
+  bool remove();
+  /** Set the file's current position to zero. */
+  void rewind() {seekSet(0);}
+  /** Set the files position to current position + \a pos. See seekSet().
+   * \param[in] offset The new position in bytes from the current position.
+   * \return true for success or false for failure.
+   */
+  bool seekCur(int32_t offset) {
+    return seekSet(curPosition_ + offset);
+  }
+  /** Set the files position to end-of-file + \a offset. See seekSet().
+   * \param[in] offset The new position in bytes from end-of-file.
+   * \return true for success or false for failure.
+   */
+  bool seekEnd(int32_t offset = 0) {return seekSet(fileSize_ + offset);}
+  bool seekSet(uint32_t pos);
+  bool sync();
+  bool truncate(uint32_t length);
+  /** \return Number of bytes that have been written to the file.  Bytes
+   * between validLength() and fileSize() were allocated by preAllocate(). */
+  uint32_t validLength() const {return validLength_;}
+  /** \return SdVolume that contains this file. */
+  SdVolume* volume() const {return vol_;}
+  void write(uint8_t b);
+  int16_t write(const void* buf, uint16_t nbyte);
+  void write(const char* str);
+//------------------------------------------------------------------------------
+ private:
+  // bits defined in flags_
+  static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC);
+  // clusters are contiguous - FAT chain not used
+  static uint8_t const F_CONTIGUOUS = 0X40;
+  // sync of directory entry set required
+  static uint8_t const F_FILE_DIR_DIRTY = 0X80;
+
+  // private data
+  uint8_t   flags_;         // See above for definition of flags_ bits
+  uint8_t   type_;          // type of file see SdFile.h for values
+  uint8_t   attributes_;    // exFAT file attributes
+  uint8_t   setCount_;      // secondary count for directory entry set
+  uint8_t   dirIndex_;      // index of file entry in dirBlock_[0]
+  uint32_t  curCluster_;    // cluster for current file position
+  uint32_t  curPosition_;   // current file position in bytes from beginning
+  uint32_t  dirBlock_[3];   // blocks for this file's directory entry set
+  uint32_t  fileSize_;      // exFAT data length
+  uint32_t  firstCluster_;  // first cluster of file
+  uint32_t  validLength_;   // exFAT valid data length
+  SdVolume* vol_;           // volume where file is located
+
+  // private functions
+  bool addCluster();
+  bool addDirCluster();
+  uint8_t* cacheSetEntry(uint8_t i, uint8_t action);
+  bool create(ExFatFile* dirFile, uint32_t pos,
+    const char* name, uint8_t len, uint8_t oflag);
+  bool freeClusters(uint32_t cluster, uint32_t count);
+  static uint16_t nameHash(const char* name, uint8_t len);
+  bool nextCluster();
+  bool open(ExFatFile* dirFile, const char* name, uint8_t len, uint8_t oflag);
+  int8_t openSet(ExFatFile* dirFile, uint8_t* file,
+    const char* name, uint8_t len, uint16_t hash, uint8_t oflag);
+  static bool parseName(const char* path, uint8_t* len, const char** ptr);
+  uint8_t* readDirCache();
+  static uint32_t timestamp();
+};
+#endif  // EXFAT_SUPPORT
+#endif  // ExFatFile_h
@@ -0,0 +1,331 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <stddef.h>
+#include <RecordFile.h>
+//------------------------------------------------------------------------------
+/** Append a record to the file.
+ *
+ * An index timestamp is written for the first record of each group.
+ *
+ * \param[in] time The timestamp for the record.  Must not be less than
+ * lastTime().
+ * \param[in] data The record's fields packed in schema order,
+ * recordSize() - 4 bytes.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the file is not open for write, \a time is
+ * less than lastTime() or an I/O error.
+ */
+bool RecordFile::append(uint32_t time, const void* data) {
+  uint8_t n = recordSize_ - 4;
+  if (!isOpen() || !writable_) goto fail;
+  if (recordCount_ && time < lastTime_) goto fail;
+
+  if ((recordCount_ % segmentRecords()) == 0) {
+    // first record of a segment - write index block
+    uint32_t fill = 0XFFFFFFFF;
+    if (!seekEnd()) goto fail;
+    if (write(&time, 4) != 4) goto fail;
+    for (uint8_t i = 1; i < RF_INDEX_PER_BLOCK; i++) {
+      if (write(&fill, 4) != 4) goto fail;
+    }
+  } else if ((recordCount_ % groupSize_) == 0) {
+    // first record of a group - add index entry
+    if (!seekSet(indexPosition(recordCount_/groupSize_))) goto fail;
+    if (write(&time, 4) != 4) goto fail;
+  }
+  if (!seekEnd()) goto fail;
+  if (write(&time, 4) != 4 || write(data, n) != n) goto fail;
+  recordCount_++;
+  lastTime_ = time;
+  return true;
+
+ fail:
+  writeError = true;
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Update the header and close the file.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool RecordFile::close() {
+  bool rtn = sync();
+  return SdFile::close() && rtn;
+}
+//------------------------------------------------------------------------------
+/** Create a new record file.
+ *
+ * \param[in] dirFile An open SdFile instance for the directory that will
+ * contain the file.
+ * \param[in] path A path with a valid 8.3 DOS name for the file.
+ * \param[in] fieldType An array of field types, RF_UINT8 ... RF_FLOAT.
+ * \param[in] fieldCount The number of fields, at most RF_MAX_FIELDS.
+ * \param[in] groupSize The number of records for each index timestamp.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the file exists, an invalid schema
+ * or an I/O error.
+ */
+bool RecordFile::create(SdFile* dirFile, const char* path,
+  const uint8_t* fieldType, uint8_t fieldCount, uint8_t groupSize) {
+  rf_header_t header;
+  uint8_t zero[32];
+  uint16_t size = 4;
+
+  // init() below must not change the layout of a file that is already open
+  if (isOpen() || fieldCount > RF_MAX_FIELDS) goto fail;
+  memset(&header, 0, sizeof(header));
+  memcpy_P(header.magic, PSTR("SDRF"), 4);
+  header.version = RF_VERSION;
+  header.fieldCount = fieldCount;
+  header.groupSize = groupSize;
+  for (uint8_t i = 0; i < fieldCount; i++) {
+    header.fieldType[i] = fieldType[i];
+    size += fieldType[i] & 0XF;
+  }
+  if (size > 255) goto fail;
+  header.recordSize = size;
+  if (!init(&header)) goto fail;
+
+  if (!SdFile::open(dirFile, path, O_CREAT | O_EXCL | O_RDWR)) goto fail;
+
+  // write header and zero rest of block zero
+  if (write(&header, sizeof(header)) != sizeof(header)) goto closeFail;
+  memset(zero, 0, sizeof(zero));
+  for (uint16_t i = sizeof(header); i < 512; i += sizeof(zero)) {
+    uint8_t n = 512 - i < sizeof(zero) ? 512 - i : sizeof(zero);
+    if (write(zero, n) != n) goto closeFail;
+  }
+  recordCount_ = 0;
+  recordIndex_ = 0;
+  lastTime_ = 0;
+  writable_ = true;
+  if (!SdFile::sync()) goto closeFail;
+  return true;
+
+ closeFail:
+  // only close the file opened here, not one the caller left open
+  SdFile::close();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// file position for the next index block or record
+uint32_t RecordFile::endPosition(uint32_t count) {
+  if (count % segmentRecords()) return recordPosition(count);
+  return 512 + (count/segmentRecords())*segmentSize_;
+}
+//------------------------------------------------------------------------------
+// file position of the index timestamp for a group
+uint32_t RecordFile::indexPosition(uint32_t group) {
+  return 512 + (group/RF_INDEX_PER_BLOCK)*segmentSize_
+         + 4*(group % RF_INDEX_PER_BLOCK);
+}
+//------------------------------------------------------------------------------
+// check the schema in header and set layout fields
+bool RecordFile::init(const rf_header_t* header) {
+  uint16_t size = 4;
+  if (strncmp_P(header->magic, PSTR("SDRF"), 4)) goto fail;
+  if (header->version != RF_VERSION) goto fail;
+  if (header->fieldCount > RF_MAX_FIELDS || header->groupSize == 0) goto fail;
+  for (uint8_t i = 0; i < header->fieldCount; i++) {
+    uint8_t s = header->fieldType[i] & 0XF;
+    if (s != 1 && s != 2 && s != 4) goto fail;
+    size += s;
+  }
+  if (size != header->recordSize) goto fail;
+
+  fieldCount_ = header->fieldCount;
+  memcpy(fieldType_, header->fieldType, RF_MAX_FIELDS);
+  groupSize_ = header->groupSize;
+  recordSize_ = header->recordSize;
+  segmentSize_ = 512 + segmentRecords()*recordSize_;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Open an existing record file.
+ *
+ * The record count is found from the file size.  A partial record left
+ * by a crash is removed if the file is opened for write.
+ *
+ * \param[in] dirFile An open SdFile instance for the directory containing
+ * the file.
+ * \param[in] path A path with a valid 8.3 DOS name for the file.
+ * \param[in] oflag O_READ or O_RDWR, optionally with O_SYNC.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool RecordFile::open(SdFile* dirFile, const char* path, uint8_t oflag) {
+  rf_header_t header;
+  uint32_t size;
+  uint32_t segment;
+
+  if (!SdFile::open(dirFile, path, oflag & (O_ACCMODE | O_SYNC))) {
+    return false;
+  }
+  if (read(&header, sizeof(header)) != sizeof(header)) goto closeFail;
+  if (!init(&header)) goto closeFail;
+
+  size = fileSize();
+  if (size < 512) goto closeFail;
+  size -= 512;
+  segment = size/segmentSize_;
+  size -= segment*segmentSize_;
+  recordCount_ = segment*segmentRecords();
+  if (size > 512) recordCount_ += (size - 512)/recordSize_;
+
+  writable_ = oflag & O_WRITE;
+  if (writable_ && fileSize() != endPosition(recordCount_)) {
+    // remove partial record or index block
+    if (!truncate(endPosition(recordCount_))) goto closeFail;
+  }
+  lastTime_ = 0;
+  if (recordCount_) {
+    if (!readTime(recordPosition(recordCount_ - 1), &lastTime_)) goto closeFail;
+  }
+  recordIndex_ = 0;
+  if (recordCount_ && !seekRecord(0)) goto closeFail;
+  return true;
+
+ closeFail:
+  SdFile::close();
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Read the next record.
+ *
+ * \param[out] time The record's timestamp.
+ * \param[out] data Location for recordSize() - 4 bytes of field data.
+ *
+ * \return The value one is returned for success, zero is returned if
+ * there are no more records and minus one is returned for an error.
+ */
+int8_t RecordFile::readRecord(uint32_t* time, void* data) {
+  uint8_t n = recordSize_ - 4;
+  if (!isOpen()) return -1;
+  if (recordIndex_ >= recordCount_) return 0;
+  if (!seekSet(recordPosition(recordIndex_))) return -1;
+  if (read(time, 4) != 4 || read(data, n) != n) return -1;
+  recordIndex_++;
+  return 1;
+}
+//------------------------------------------------------------------------------
+// read a timestamp at pos
+bool RecordFile::readTime(uint32_t pos, uint32_t* time) {
+  return seekSet(pos) && read(time, 4) == 4;
+}
+//------------------------------------------------------------------------------
+// file position of a record
+uint32_t RecordFile::recordPosition(uint32_t index) {
+  uint32_t segment = index/segmentRecords();
+  return 1024 + segment*segmentSize_
+         + (index - segment*segmentRecords())*recordSize_;
+}
+//------------------------------------------------------------------------------
+/** Set the index of the next record to be read.
+ *
+ * \param[in] index The record index, zero is the first record.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool RecordFile::seekRecord(uint32_t index) {
+  if (!isOpen() || index >= recordCount_) return false;
+  recordIndex_ = index;
+  return seekSet(recordPosition(index));
+}
+//------------------------------------------------------------------------------
+/** Position the file at the first record with a timestamp greater than
+ * or equal to \a time.
+ *
+ * The index is searched first, then the records of one group.
+ *
+ * \param[in] time The timestamp to find.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include no record has a timestamp greater than
+ * or equal to \a time or an I/O error.
+ */
+bool RecordFile::seekTime(uint32_t time) {
+  uint32_t lo = 0;
+  uint32_t hi;
+  uint32_t t;
+
+  if (!isOpen() || recordCount_ == 0) goto fail;
+
+  // find first group with an index timestamp not less than time
+  hi = (recordCount_ + groupSize_ - 1)/groupSize_;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi)/2;
+    if (!readTime(indexPosition(mid), &t)) goto fail;
+    if (t < time) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  if (lo == 0) return seekRecord(0);
+
+  // record is in group lo - 1 after its first record or starts group lo
+  hi = lo*groupSize_;
+  if (hi > recordCount_) hi = recordCount_;
+  lo = (lo - 1)*groupSize_ + 1;
+  while (lo < hi) {
+    uint32_t mid = (lo + hi)/2;
+    if (!readTime(recordPosition(mid), &t)) goto fail;
+    if (t < time) {
+      lo = mid + 1;
+    } else {
+      hi = mid;
+    }
+  }
+  return seekRecord(lo);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Write the record count to the header and flush cached data.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool RecordFile::sync() {
+  if (!isOpen()) return false;
+  if (writable_) {
+    if (!seekSet(offsetof(rf_header_t, recordCount))) goto fail;
+    if (write(&recordCount_, 4) != 4) goto fail;
+  }
+  return SdFile::sync();
+
+ fail:
+  writeError = true;
+  return false;
+}
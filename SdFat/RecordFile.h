@@ -0,0 +1,147 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef RecordFile_h
+#define RecordFile_h
+/**
+ * \file
+ * \brief RecordFile class
+ */
+#include <SdFile.h>
+//------------------------------------------------------------------------------
+// field types - the low nibble is the size of the field in bytes
+/** record field type for uint8_t */
+uint8_t const RF_UINT8 = 0X01;
+/** record field type for int8_t */
+uint8_t const RF_INT8 = 0X11;
+/** record field type for uint16_t */
+uint8_t const RF_UINT16 = 0X02;
+/** record field type for int16_t */
+uint8_t const RF_INT16 = 0X12;
+/** record field type for uint32_t */
+uint8_t const RF_UINT32 = 0X04;
+/** record field type for int32_t */
+uint8_t const RF_INT32 = 0X14;
+/** record field type for float */
+uint8_t const RF_FLOAT = 0X24;
+/** Maximum number of fields in a record, not including the timestamp */
+uint8_t const RF_MAX_FIELDS = 16;
+/** Number of timestamps in an index block */
+uint8_t const RF_INDEX_PER_BLOCK = 128;
+/** RecordFile format version */
+uint8_t const RF_VERSION = 1;
+//------------------------------------------------------------------------------
+/**
+ * \struct recordFileHeader
+ * \brief Header at the start of block zero of a record file.
+ *
+ * The rest of block zero is zero filled.
+ */
+struct recordFileHeader {
+           /** "SDRF" */
+  char     magic[4];
+           /** RF_VERSION */
+  uint8_t  version;
+           /** number of fields in a record */
+  uint8_t  fieldCount;
+           /** number of records for each index timestamp */
+  uint8_t  groupSize;
+           /** size of a record including the timestamp */
+  uint8_t  recordSize;
+           /** number of records at the last sync() */
+  uint32_t recordCount;
+           /** field types, RF_UINT8 ... RF_FLOAT */
+  uint8_t  fieldType[RF_MAX_FIELDS];
+};
+/** Type name for recordFileHeader */
+typedef struct recordFileHeader rf_header_t;
+//------------------------------------------------------------------------------
+/**
+ * \class RecordFile
+ * \brief Binary file of fixed size time-stamped records.
+ *
+ * A record file starts with a 512 byte header block that holds the record
+ * schema.  The rest of the file is a series of segments.  Each segment is
+ * a 512 byte index block followed by RF_INDEX_PER_BLOCK groups of
+ * groupSize records.  The index block holds the timestamp of the first
+ * record of each group in the segment.
+ *
+ * Records are packed with a uint32_t timestamp followed by the fields in
+ * schema order.  Timestamps must not decrease.
+ *
+ * seekTime() does a binary search of the index entries followed by a binary
+ * search of one group so only a few blocks are read to find a record in a
+ * large file.
+ */
+class RecordFile : protected SdFile {
+ public:
+  RecordFile() : recordSize_(0) {}
+  bool append(uint32_t time, const void* data);
+  bool close();
+  bool create(SdFile* dirFile, const char* path,
+    const uint8_t* fieldType, uint8_t fieldCount, uint8_t groupSize);
+  /** \return The number of fields in a record. */
+  uint8_t fieldCount() const {return fieldCount_;}
+  /** \return The type of field \a i or zero if \a i is too large.
+   * \param[in] i The index of the field.
+   */
+  uint8_t fieldType(uint8_t i) const {
+    return i < fieldCount_ ? fieldType_[i] : 0;
+  }
+  /** \return The number of records for each index timestamp. */
+  uint8_t groupSize() const {return groupSize_;}
+  /** \return True if the file is open else false. */
+  bool isOpen() const {return SdFile::isOpen();}
+  /** \return The timestamp of the last record in the file. */
+  uint32_t lastTime() const {return lastTime_;}
+  bool open(SdFile* dirFile, const char* path, uint8_t oflag = O_READ);
+  int8_t readRecord(uint32_t* time, void* data);
+  /** \return The number of records in the file. */
+  uint32_t recordCount() const {return recordCount_;}
+  /** \return The index of the record that will be returned by the next
+   * call to readRecord(). */
+  uint32_t recordIndex() const {return recordIndex_;}
+  /** \return The size of a record in bytes including the timestamp. */
+  uint8_t recordSize() const {return recordSize_;}
+  bool seekRecord(uint32_t index);
+  bool seekTime(uint32_t time);
+  bool sync();
+  /** SdFile::writeError is set true if an error occurs during append(). */
+  using SdFile::writeError;
+
+ private:
+  uint8_t  fieldCount_;
+  uint8_t  fieldType_[RF_MAX_FIELDS];
+  uint8_t  groupSize_;
+  uint8_t  recordSize_;
+  uint32_t lastTime_;
+  uint32_t recordCount_;
+  uint32_t recordIndex_;
+  uint32_t segmentSize_;
+  bool     writable_;
+
+  uint32_t endPosition(uint32_t count);
+  uint32_t indexPosition(uint32_t group);
+  bool init(const rf_header_t* header);
+  bool readTime(uint32_t pos, uint32_t* time);
+  uint32_t recordPosition(uint32_t index);
+  /** \return The number of records in a segment. */
+  uint32_t segmentRecords() {return (uint32_t)RF_INDEX_PER_BLOCK*groupSize_;}
+};
+#endif  // RecordFile_h
@@ -20,6 +20,76 @@
 #include <WProgram.h>
 #include "Sd2Card.h"
 //------------------------------------------------------------------------------
+#if USE_SD_CRC
+// CRC functions for CMD59 CRC mode
+//------------------------------------------------------------------------------
+/** CRC7 for SD commands, returns CRC shifted with end bit set */
+static uint8_t CRC7(const uint8_t* data, uint8_t n) {
+  uint8_t crc = 0;
+  for (uint8_t i = 0; i < n; i++) {
+    uint8_t d = data[i];
+    for (uint8_t j = 0; j < 8; j++) {
+      crc <<= 1;
+      if ((d ^ crc) & 0X80) crc ^= 0X09;
+      d <<= 1;
+    }
+  }
+  return (crc << 1) | 1;
+}
+#if USE_SD_CRC == 1
+#include <util/crc16.h>
+//------------------------------------------------------------------------------
+/** CRC16 CCITT update with the avr-libc shift and XOR function */
+static inline __attribute__((always_inline))
+  uint16_t crcUpdate(uint16_t crc, uint8_t data) {
+  return _crc_xmodem_update(crc, data);
+}
+#else  // USE_SD_CRC == 1
+//------------------------------------------------------------------------------
+/** CRC16 CCITT table for polynomial 0X1021 */
+static const uint16_t crctab[] PROGMEM = {
+  0X0000, 0X1021, 0X2042, 0X3063, 0X4084, 0X50A5, 0X60C6, 0X70E7,
+  0X8108, 0X9129, 0XA14A, 0XB16B, 0XC18C, 0XD1AD, 0XE1CE, 0XF1EF,
+  0X1231, 0X0210, 0X3273, 0X2252, 0X52B5, 0X4294, 0X72F7, 0X62D6,
+  0X9339, 0X8318, 0XB37B, 0XA35A, 0XD3BD, 0XC39C, 0XF3FF, 0XE3DE,
+  0X2462, 0X3443, 0X0420, 0X1401, 0X64E6, 0X74C7, 0X44A4, 0X5485,
+  0XA56A, 0XB54B, 0X8528, 0X9509, 0XE5EE, 0XF5CF, 0XC5AC, 0XD58D,
+  0X3653, 0X2672, 0X1611, 0X0630, 0X76D7, 0X66F6, 0X5695, 0X46B4,
+  0XB75B, 0XA77A, 0X9719, 0X8738, 0XF7DF, 0XE7FE, 0XD79D, 0XC7BC,
+  0X48C4, 0X58E5, 0X6886, 0X78A7, 0X0840, 0X1861, 0X2802, 0X3823,
+  0XC9CC, 0XD9ED, 0XE98E, 0XF9AF, 0X8948, 0X9969, 0XA90A, 0XB92B,
+  0X5AF5, 0X4AD4, 0X7AB7, 0X6A96, 0X1A71, 0X0A50, 0X3A33, 0X2A12,
+  0XDBFD, 0XCBDC, 0XFBBF, 0XEB9E, 0X9B79, 0X8B58, 0XBB3B, 0XAB1A,
+  0X6CA6, 0X7C87, 0X4CE4, 0X5CC5, 0X2C22, 0X3C03, 0X0C60, 0X1C41,
+  0XEDAE, 0XFD8F, 0XCDEC, 0XDDCD, 0XAD2A, 0XBD0B, 0X8D68, 0X9D49,
+  0X7E97, 0X6EB6, 0X5ED5, 0X4EF4, 0X3E13, 0X2E32, 0X1E51, 0X0E70,
+  0XFF9F, 0XEFBE, 0XDFDD, 0XCFFC, 0XBF1B, 0XAF3A, 0X9F59, 0X8F78,
+  0X9188, 0X81A9, 0XB1CA, 0XA1EB, 0XD10C, 0XC12D, 0XF14E, 0XE16F,
+  0X1080, 0X00A1, 0X30C2, 0X20E3, 0X5004, 0X4025, 0X7046, 0X6067,
+  0X83B9, 0X9398, 0XA3FB, 0XB3DA, 0XC33D, 0XD31C, 0XE37F, 0XF35E,
+  0X02B1, 0X1290, 0X22F3, 0X32D2, 0X4235, 0X5214, 0X6277, 0X7256,
+  0XB5EA, 0XA5CB, 0X95A8, 0X8589, 0XF56E, 0XE54F, 0XD52C, 0XC50D,
+  0X34E2, 0X24C3, 0X14A0, 0X0481, 0X7466, 0X6447, 0X5424, 0X4405,
+  0XA7DB, 0XB7FA, 0X8799, 0X97B8, 0XE75F, 0XF77E, 0XC71D, 0XD73C,
+  0X26D3, 0X36F2, 0X0691, 0X16B0, 0X6657, 0X7676, 0X4615, 0X5634,
+  0XD94C, 0XC96D, 0XF90E, 0XE92F, 0X99C8, 0X89E9, 0XB98A, 0XA9AB,
+  0X5844, 0X4865, 0X7806, 0X6827, 0X18C0, 0X08E1, 0X3882, 0X28A3,
+  0XCB7D, 0XDB5C, 0XEB3F, 0XFB1E, 0X8BF9, 0X9BD8, 0XABBB, 0XBB9A,
+  0X4A75, 0X5A54, 0X6A37, 0X7A16, 0X0AF1, 0X1AD0, 0X2AB3, 0X3A92,
+  0XFD2E, 0XED0F, 0XDD6C, 0XCD4D, 0XBDAA, 0XAD8B, 0X9DE8, 0X8DC9,
+  0X7C26, 0X6C07, 0X5C64, 0X4C45, 0X3CA2, 0X2C83, 0X1CE0, 0X0CC1,
+  0XEF1F, 0XFF3E, 0XCF5D, 0XDF7C, 0XAF9B, 0XBFBA, 0X8FD9, 0X9FF8,
+  0X6E17, 0X7E36, 0X4E55, 0X5E74, 0X2E93, 0X3EB2, 0X0ED1, 0X1EF0
+};
+//------------------------------------------------------------------------------
+/** CRC16 CCITT update with one table lookup */
+static inline __attribute__((always_inline))
+  uint16_t crcUpdate(uint16_t crc, uint8_t data) {
+  return (crc << 8) ^ pgm_read_word(&crctab[(crc >> 8) ^ data]);
+}
+#endif  // USE_SD_CRC == 1
+#endif  // USE_SD_CRC
+//------------------------------------------------------------------------------
 #ifndef SOFTWARE_SPI
 // functions for hardware SPI
 //------------------------------------------------------------------------------
@@ -44,18 +114,30 @@ static uint8_t spiRec() {
   return SPDR;
 }
 //------------------------------------------------------------------------------
-/** SPI read data - only one call so force inline */
+/** SPI read data - only one call so force inline
+ * \return CRC16 of data if USE_SD_CRC is nonzero else zero
+ */
 static inline __attribute__((always_inline))
-  void spiRead(uint8_t* buf, uint16_t nbyte) {
-  if (nbyte-- == 0) return;
+  uint16_t spiRead(uint8_t* buf, uint16_t nbyte) {
+  uint16_t crc = 0;
+  if (nbyte-- == 0) return crc;
   SPDR = 0XFF;
   for (uint16_t i = 0; i < nbyte; i++) {
     while (!(SPSR & (1 << SPIF)));
-    buf[i] = SPDR;
+    uint8_t b = SPDR;
     SPDR = 0XFF;
+    buf[i] = b;
+#if USE_SD_CRC
+    // overlap CRC with receive of next byte
+    crc = crcUpdate(crc, b);
+#endif  // USE_SD_CRC
   }
   while (!(SPSR & (1 << SPIF)));
   buf[nbyte] = SPDR;
+#if USE_SD_CRC
+  crc = crcUpdate(crc, buf[nbyte]);
+#endif  // USE_SD_CRC
+  return crc;
 }
 //------------------------------------------------------------------------------
 /** SPI send a byte */
@@ -64,17 +146,28 @@ static void spiSend(uint8_t b) {
   while (!(SPSR & (1 << SPIF)));
 }
 //------------------------------------------------------------------------------
-/** SPI send block - only one call so force inline */
+/** SPI send block - only one call so force inline
+ * \return CRC16 of data if USE_SD_CRC is nonzero else zero
+ */
 static inline __attribute__((always_inline))
-  void spiSendBlock(uint8_t token, const uint8_t* buf) {
+  uint16_t spiSendBlock(uint8_t token, const uint8_t* buf) {
+  uint16_t crc = 0;
   SPDR = token;
   for (uint16_t i = 0; i < 512; i += 2) {
     while (!(SPSR & (1 << SPIF)));
     SPDR = buf[i];
+#if USE_SD_CRC
+    // overlap CRC with send of byte
+    crc = crcUpdate(crc, buf[i]);
+#endif  // USE_SD_CRC
     while (!(SPSR & (1 << SPIF)));
     SPDR = buf[i + 1];
+#if USE_SD_CRC
+    crc = crcUpdate(crc, buf[i + 1]);
+#endif  // USE_SD_CRC
   }
   while (!(SPSR & (1 << SPIF)));
+  return crc;
 }
 //------------------------------------------------------------------------------
 #else  // SOFTWARE_SPI
@@ -82,69 +175,143 @@ static inline __attribute__((always_inline))
 /** nop to tune soft SPI timing */
 #define nop asm volatile ("nop\n\t")
 //------------------------------------------------------------------------------
-/** Soft SPI receive byte */
-static uint8_t spiRec() {
-  uint8_t data = 0;
-  // no interrupts during byte receive - about 8 us
-  cli();
-  // output pin high - like sending 0XFF
-  fastDigitalWrite(SPI_MOSI_PIN, HIGH);
-
-  for (uint8_t i = 0; i < 8; i++) {
-    fastDigitalWrite(SPI_SCK_PIN, HIGH);
+/**
+ * \class SoftSpi
+ * \brief Bit-bang SPI with pins fixed at compile time.
+ *
+ * Pin numbers are template arguments so each pin access compiles to a
+ * single sbi, cbi, or sbic instruction and the bit loops are unrolled.
+ */
+template<uint8_t MisoPin, uint8_t MosiPin, uint8_t SckPin>
+class SoftSpi {
+ public:
+  /** Soft SPI receive byte, interrupts must be disabled */
+  static inline __attribute__((always_inline)) uint8_t receive() {
+    uint8_t data = 0;
+    // output pin high - like sending 0XFF
+    fastDigitalWrite(MosiPin, HIGH);
+    receiveBit(7, &data);
+    receiveBit(6, &data);
+    receiveBit(5, &data);
+    receiveBit(4, &data);
+    receiveBit(3, &data);
+    receiveBit(2, &data);
+    receiveBit(1, &data);
+    receiveBit(0, &data);
+    return data;
+  }
+  /** Soft SPI send byte, interrupts must be disabled */
+  static inline __attribute__((always_inline)) void send(uint8_t data) {
+    sendBit(7, data);
+    sendBit(6, data);
+    sendBit(5, data);
+    sendBit(4, data);
+    sendBit(3, data);
+    sendBit(2, data);
+    sendBit(1, data);
+    sendBit(0, data);
+    // hold SCK high for a few ns
+    nop;
+    nop;
+    nop;
+    nop;
+    fastDigitalWrite(SckPin, LOW);
+  }
 
+ private:
+  static inline __attribute__((always_inline))
+    void receiveBit(uint8_t bit, uint8_t* data) {
+    fastDigitalWrite(SckPin, HIGH);
     // adjust so SCK is nice
     nop;
     nop;
-
-    data <<= 1;
-
-    if (fastDigitalRead(SPI_MISO_PIN)) data |= 1;
-
-    fastDigitalWrite(SPI_SCK_PIN, LOW);
+    if (fastDigitalRead(MisoPin)) *data |= 1 << bit;
+    fastDigitalWrite(SckPin, LOW);
+  }
+  static inline __attribute__((always_inline))
+    void sendBit(uint8_t bit, uint8_t data) {
+    fastDigitalWrite(SckPin, LOW);
+    fastDigitalWrite(MosiPin, data & (1 << bit));
+    fastDigitalWrite(SckPin, HIGH);
   }
-  // enable interrupts
-  sei();
+};
+/** Soft SPI for the SOFT_SPI_* pins in SdFatConfig.h */
+typedef SoftSpi<SPI_MISO_PIN, SPI_MOSI_PIN, SPI_SCK_PIN> SdSoftSpi;
+//------------------------------------------------------------------------------
+/** Soft SPI receive byte */
+static uint8_t spiRec() {
+  // no interrupts during byte receive - a few us
+  uint8_t sreg = SREG;
+  cli();
+  uint8_t data = SdSoftSpi::receive();
+  SREG = sreg;
   return data;
 }
 //------------------------------------------------------------------------------
-/** Soft SPI read data */
-static void spiRead(uint8_t* buf, uint16_t nbyte) {
+/** Soft SPI read data - only one call so force inline
+ * \return CRC16 of data if USE_SD_CRC is nonzero else zero
+ */
+static inline __attribute__((always_inline))
+  uint16_t spiRead(uint8_t* buf, uint16_t nbyte) {
+  uint16_t crc = 0;
+  uint8_t sreg = SREG;
+#if SOFT_SPI_BLOCK_CLI
+  // no interrupts during block receive
+  cli();
+#endif  // SOFT_SPI_BLOCK_CLI
   for (uint16_t i = 0; i < nbyte; i++) {
-    buf[i] = spiRec();
+#if !SOFT_SPI_BLOCK_CLI
+    cli();
+#endif  // SOFT_SPI_BLOCK_CLI
+    uint8_t b = SdSoftSpi::receive();
+#if !SOFT_SPI_BLOCK_CLI
+    SREG = sreg;
+#endif  // SOFT_SPI_BLOCK_CLI
+    buf[i] = b;
+#if USE_SD_CRC
+    crc = crcUpdate(crc, b);
+#endif  // USE_SD_CRC
   }
+  SREG = sreg;
+  return crc;
 }
 //------------------------------------------------------------------------------
 /** Soft SPI send byte */
 static void spiSend(uint8_t data) {
-  // no interrupts during byte send - about 8 us
+  // no interrupts during byte send - a few us
+  uint8_t sreg = SREG;
   cli();
-  for (uint8_t i = 0; i < 8; i++) {
-    fastDigitalWrite(SPI_SCK_PIN, LOW);
-
-    fastDigitalWrite(SPI_MOSI_PIN, data & 0X80);
-
-    data <<= 1;
-
-    fastDigitalWrite(SPI_SCK_PIN, HIGH);
-  }
-  // hold SCK high for a few ns
-  nop;
-  nop;
-  nop;
-  nop;
-
-  fastDigitalWrite(SPI_SCK_PIN, LOW);
-  // enable interrupts
-  sei();
+  SdSoftSpi::send(data);
+  SREG = sreg;
 }
 //------------------------------------------------------------------------------
-/** Soft SPI send block */
-  void spiSendBlock(uint8_t token, const uint8_t* buf) {
+/** Soft SPI send block - only one call so force inline
+ * \return CRC16 of data if USE_SD_CRC is nonzero else zero
+ */
+static inline __attribute__((always_inline))
+  uint16_t spiSendBlock(uint8_t token, const uint8_t* buf) {
+  uint16_t crc = 0;
+  uint8_t sreg = SREG;
   spiSend(token);
+#if SOFT_SPI_BLOCK_CLI
+  // no interrupts during block send
+  cli();
+#endif  // SOFT_SPI_BLOCK_CLI
   for (uint16_t i = 0; i < 512; i++) {
-    spiSend(buf[i]);
+    uint8_t b = buf[i];
+#if !SOFT_SPI_BLOCK_CLI
+    cli();
+#endif  // SOFT_SPI_BLOCK_CLI
+    SdSoftSpi::send(b);
+#if !SOFT_SPI_BLOCK_CLI
+    SREG = sreg;
+#endif  // SOFT_SPI_BLOCK_CLI
+#if USE_SD_CRC
+    crc = crcUpdate(crc, b);
+#endif  // USE_SD_CRC
   }
+  SREG = sreg;
+  return crc;
 }
 #endif  // SOFTWARE_SPI
 //------------------------------------------------------------------------------
@@ -160,6 +327,16 @@ uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg) {
   // wait up to 300 ms if busy
   waitNotBusy(300);
 
+#if USE_SD_CRC
+  // form message
+  uint8_t d[6] = {cmd | 0X40, arg >> 24, arg >> 16, arg >> 8, arg, 0};
+
+  // add CRC
+  d[5] = CRC7(d, 5);
+
+  // send message
+  for (uint8_t k = 0; k < 6; k++) spiSend(d[k]);
+#else  // USE_SD_CRC
   // send command
   spiSend(cmd | 0x40);
 
@@ -171,6 +348,7 @@ uint8_t Sd2Card::cardCommand(uint8_t cmd, uint32_t arg) {
   if (cmd == CMD0) crc = 0X95;  // correct crc for CMD0 with arg 0
   if (cmd == CMD8) crc = 0X87;  // correct crc for CMD8 with arg 0X1AA
   spiSend(crc);
+#endif  // USE_SD_CRC
 
   // wait for response
   for (uint8_t i = 0; ((status_ = spiRec()) & 0X80) && i != 0XFF; i++);
@@ -327,6 +505,13 @@ bool Sd2Card::init(uint8_t sckRateID, uint8_t chipSelectPin) {
     }
     type(SD_CARD_TYPE_SD2);
   }
+#if USE_SD_CRC
+  // enable CRC checking for commands and data
+  if (cardCommand(CMD59, 1) != R1_IDLE_STATE) {
+    error(SD_CARD_ERROR_CMD59);
+    goto fail;
+  }
+#endif  // USE_SD_CRC
   // initialize card and send host supports SDHC if SD2
   arg = type() == SD_CARD_TYPE_SD2 ? 0X40000000 : 0;
 
@@ -378,23 +563,38 @@ bool Sd2Card::readBlock(uint32_t block, uint8_t* dst) {
   }
   if (!waitStartBlock()) goto fail;
   // transfer data
-  readData(dst, 512);
-  return true;
+  return readData(dst, 512);
 
  fail:
   chipSelectHigh();
   return false;
 }
 //------------------------------------------------------------------------------
-/**
- *
- */
-void Sd2Card::readData(uint8_t* dst, uint16_t count) {
+// read data and check CRC if USE_SD_CRC is nonzero
+bool Sd2Card::readData(uint8_t* dst, uint16_t count) {
+#if USE_SD_CRC
+  uint16_t crc = spiRead(dst, count);
+  // CRC is sent high byte first
+  uint16_t recCrc = spiRec() << 8;
+  recCrc |= spiRec();
+  if (crc != recCrc) {
+    error(SD_CARD_ERROR_READ_CRC);
+    goto fail;
+  }
+#else  // USE_SD_CRC
   spiRead(dst, count);
   // discard CRC
   spiRec();
   spiRec();
+#endif  // USE_SD_CRC
   chipSelectHigh();
+  return true;
+
+#if USE_SD_CRC
+ fail:
+  chipSelectHigh();
+  return false;
+#endif  // USE_SD_CRC
 }
 //------------------------------------------------------------------------------
 /** read CID or CSR register */
@@ -406,8 +606,7 @@ bool Sd2Card::readRegister(uint8_t cmd, void* buf) {
   }
   if (!waitStartBlock()) goto fail;
   // transfer data
-  readData(dst, 16);
-  return true;
+  return readData(dst, 16);
 
  fail:
   chipSelectHigh();
@@ -528,10 +727,16 @@ bool Sd2Card::writeData(const uint8_t* src) {
 //------------------------------------------------------------------------------
 // send one block of data for write block or write multiple blocks
 bool Sd2Card::writeData(uint8_t token, const uint8_t* src) {
+#if USE_SD_CRC
+  uint16_t crc = spiSendBlock(token, src);
+  spiSend(crc >> 8);
+  spiSend(crc & 0XFF);
+#else  // USE_SD_CRC
   spiSendBlock(token, src);
 
   spiSend(0xff);  // dummy crc
   spiSend(0xff);  // dummy crc
+#endif  // USE_SD_CRC
 
   status_ = spiRec();
   if ((status_ & DATA_RES_MASK) != DATA_RES_ACCEPTED) goto fail;
@@ -133,6 +133,10 @@ uint8_t const SD_CARD_ERROR_WRITE_TIMEOUT = 0X15;
 uint8_t const SD_CARD_ERROR_SCK_RATE = 0X16;
 /** init() not called */
 uint8_t const SD_CARD_ERROR_INIT_NOT_CALLED = 0X17;
+/** card returned an error response for CMD59 (CRC_ON_OFF) */
+uint8_t const SD_CARD_ERROR_CMD59 = 0X18;
+/** invalid CRC for read data */
+uint8_t const SD_CARD_ERROR_READ_CRC = 0X19;
 //------------------------------------------------------------------------------
 // card types
 /** Standard capacity V1 SD card */
@@ -219,7 +223,7 @@ class Sd2Card {
   }
   uint8_t cardCommand(uint8_t cmd, uint32_t arg);
 
-  void readData(uint8_t* dst, uint16_t count);
+  bool readData(uint8_t* dst, uint16_t count);
   bool readRegister(uint8_t cmd, void* buf);
   void chipSelectHigh();
   void chipSelectLow();
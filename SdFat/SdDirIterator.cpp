@@ -0,0 +1,144 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <SdDirIterator.h>
+//------------------------------------------------------------------------------
+/** Start a scan of a directory.
+ *
+ * An entry is returned if (attributes & \a attrMask) == \a attrValue and
+ * its extension matches \a ext.  For example \a attrMask = DIR_ATT_DIRECTORY
+ * and \a attrValue = 0 returns only files.
+ *
+ * \param[in] dir An open SdFile instance for the directory.
+ * \param[in] attrMask Attribute bits to test.
+ * \param[in] attrValue Required value of the tested bits.
+ * \param[in] ext If not null, the extension to match.  Case is ignored.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include \a dir is not an open directory.
+ */
+bool SdDirIterator::begin(SdFile* dir, uint8_t attrMask, uint8_t attrValue,
+  const char* ext) {
+  dir_ = 0;
+  if (!dir->isDir()) return false;
+  attrMask_ = attrMask;
+  attrValue_ = attrValue;
+  useExt_ = ext != 0;
+  if (useExt_) {
+    // upper case and blank fill to match the short name field
+    for (uint8_t i = 0; i < 3; i++) {
+      uint8_t c = *ext ? *ext++ : ' ';
+      ext_[i] = 'a' <= c && c <= 'z' ? c - ('a' - 'A') : c;
+    }
+  }
+  dir_ = dir;
+  rewind();
+  return true;
+}
+//------------------------------------------------------------------------------
+/** Copy the useful fields of a directory entry.
+ *
+ * \param[in] p The directory entry.
+ * \param[in] index The index of the entry in its directory.
+ * \param[out] info The packed copy.
+ */
+void SdDirIterator::copyInfo(const dir_t* p, uint16_t index,
+  dir_info_t* info) {
+  memcpy(info->name, p->name, 11);
+  info->attributes = p->attributes;
+  info->index = index;
+  info->lastWriteDate = p->lastWriteDate;
+  info->lastWriteTime = p->lastWriteTime;
+  info->firstCluster = (uint32_t)p->firstClusterHigh << 16 | p->firstClusterLow;
+  info->fileSize = p->fileSize;
+}
+//------------------------------------------------------------------------------
+/** Find the next entry that passes the filters.
+ *
+ * \return A pointer to the entry in the SdVolume cache or null if there
+ * are no more entries or an error occurs.  Use error() to test for
+ * an I/O error.
+ */
+const dir_t* SdDirIterator::next() {
+  SdVolume* vol;
+  if (!dir_ || error_) return 0;
+  vol = dir_->vol_;
+
+  while (dir_->curPosition_ < dir_->fileSize_) {
+    const dir_t* p;
+    uint8_t i = (dir_->curPosition_ >> 5) & 0XF;
+
+    if (i && vol->cacheBlockNumber() == block_) {
+      // entry is in the block cached for the previous entry
+      p = vol->cache()->dir + i;
+      dir_->curPosition_ += 32;
+    } else {
+      // locate and cache block
+      p = dir_->readDirCache();
+      if (!p) {
+        error_ = true;
+        return 0;
+      }
+      block_ = vol->cacheBlockNumber();
+    }
+    if (p->name[0] == DIR_NAME_FREE) {
+      // stay on last entry so following calls also return null
+      dir_->curPosition_ -= 32;
+      break;
+    }
+    // skip empty entries, entries for . and .. and long name entries
+    if (p->name[0] == DIR_NAME_DELETED || p->name[0] == '.') continue;
+    if (!DIR_IS_FILE_OR_SUBDIR(p)) continue;
+
+    // apply filters in place
+    if ((p->attributes & attrMask_) != attrValue_) continue;
+    if (useExt_ && memcmp(p->name + 8, ext_, 3)) continue;
+
+    index_ = (dir_->curPosition_ >> 5) - 1;
+    return p;
+  }
+  return 0;
+}
+//------------------------------------------------------------------------------
+/** Copy up to \a count entries that pass the filters to an array.
+ *
+ * \param[out] info Array for the entries.
+ * \param[in] count Size of the array.
+ *
+ * \return The number of entries copied, zero if no more entries are
+ * found, or -1 if an error occurs.
+ */
+int16_t SdDirIterator::nextInfo(dir_info_t* info, uint16_t count) {
+  int16_t n = 0;
+  while (n < count) {
+    const dir_t* p = next();
+    if (!p) break;
+    copyInfo(p, index_, info + n++);
+  }
+  return error_ ? -1 : n;
+}
+//------------------------------------------------------------------------------
+/** Restart the scan at the first entry of the directory. */
+void SdDirIterator::rewind() {
+  if (dir_) dir_->rewind();
+  block_ = 0XFFFFFFFF;
+  index_ = 0;
+  error_ = false;
+}
@@ -0,0 +1,87 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef SdDirIterator_h
+#define SdDirIterator_h
+/**
+ * \file
+ * \brief SdDirIterator class
+ */
+#include <SdFile.h>
+//------------------------------------------------------------------------------
+/**
+ * \struct dirInfo
+ * \brief Packed copy of the useful fields of a directory entry.
+ */
+struct dirInfo {
+           /** Short 8.3 name with blank fill, same as dir_t::name. */
+  uint8_t  name[11];
+           /** Entry attributes.  See defines that begin with DIR_ATT_. */
+  uint8_t  attributes;
+           /** Index of the entry in the directory.  Use with
+            *  SdFile::open(SdFile*, uint16_t, uint8_t). */
+  uint16_t index;
+           /** Date of last write. */
+  uint16_t lastWriteDate;
+           /** Time of last write. */
+  uint16_t lastWriteTime;
+           /** First cluster of the file. */
+  uint32_t firstCluster;
+           /** File size in bytes. */
+  uint32_t fileSize;
+};
+/** Type name for dirInfo */
+typedef struct dirInfo dir_info_t;
+//------------------------------------------------------------------------------
+/**
+ * \class SdDirIterator
+ * \brief Fast scan of the files and subdirectories in a directory.
+ *
+ * next() returns a pointer to the directory entry in the SdVolume cache.
+ * Filters are applied to the cached entry so entries are not copied and
+ * the cache is only searched once for each block of 16 entries.
+ *
+ * The pointer returned by next() is valid until the cache is used for
+ * another block.  nextInfo() copies entries to a caller's array.
+ */
+class SdDirIterator {
+ public:
+  SdDirIterator() : dir_(0) {}
+  bool begin(SdFile* dir, uint8_t attrMask = 0, uint8_t attrValue = 0,
+    const char* ext = 0);
+  static void copyInfo(const dir_t* p, uint16_t index, dir_info_t* info);
+  /** \return True if an I/O error occurred. */
+  bool error() const {return error_;}
+  /** \return The index in the directory of the entry last returned. */
+  uint16_t index() const {return index_;}
+  const dir_t* next();
+  int16_t nextInfo(dir_info_t* info, uint16_t count);
+  void rewind();
+
+ private:
+  SdFile*  dir_;
+  uint32_t block_;
+  uint16_t index_;
+  uint8_t  attrMask_;
+  uint8_t  attrValue_;
+  bool     error_;
+  bool     useExt_;
+  uint8_t  ext_[3];
+};
+#endif  // SdDirIterator_h
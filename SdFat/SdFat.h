@@ -25,6 +25,10 @@
  */
 #include <SdStream.h>
 #include <ArduinoStream.h>
+#include <ExFatFile.h>
+#include <SdDirIterator.h>
+#include <RecordFile.h>
+#include <SdFormatter.h>
 //------------------------------------------------------------------------------
 /**
  * \class SdFat
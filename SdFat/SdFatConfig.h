@@ -62,12 +62,36 @@
  */
 #define FAT12_SUPPORT 0
 //------------------------------------------------------------------------------
+/**
+ * Allow exFAT volumes if EXFAT_SUPPORT is nonzero.
+ *
+ * exFAT volumes are accessed with the ExFatFile class.  SdFile only
+ * supports FAT12, FAT16 and FAT32 volumes.  exFAT support adds the
+ * allocation bitmap code to every sketch so it is off by default.
+ */
+#define EXFAT_SUPPORT 0
+//------------------------------------------------------------------------------
 /**
  * SPI init rate for SD initialization commands. Must be 5 (F_CPU/64)
  * or 6 (F_CPU/128).
  */
 #define SPI_SD_INIT_RATE 5
 //------------------------------------------------------------------------------
+/**
+ * Set USE_SD_CRC nonzero to enable SD CRC checking with CMD59.
+ *
+ * Commands are sent with a CRC7.  A CRC16 is computed for data blocks
+ * while bytes are sent or received.  Read data with a bad CRC returns
+ * an error and the card rejects write data with a bad CRC.
+ *
+ * USE_SD_CRC 1 - use the avr-libc _crc_xmodem_update() function.
+ * This is small but slows reads and writes at high SPI rates.
+ *
+ * USE_SD_CRC 2 - use a 512 byte table in flash.  The table lookup mostly
+ * overlaps the SPI transfer of the next byte.
+ */
+#define USE_SD_CRC 0
+//------------------------------------------------------------------------------
 /**
  * Set the SS pin high for hardware SPI.  If SS is chip select for another SPI
  * device this will disable that device during the SD init phase.
@@ -97,6 +121,13 @@ uint8_t const SOFT_SPI_MOSI_PIN = 11;
 uint8_t const SOFT_SPI_MISO_PIN = 12;
 /** Software SPI Clock pin */
 uint8_t const SOFT_SPI_SCK_PIN = 13;
+/**
+ * Set SOFT_SPI_BLOCK_CLI nonzero to disable interrupts for an entire
+ * 512 byte block transfer with software SPI.  This is fastest but delays
+ * interrupts for about a millisecond so millis() and Serial receive may
+ * lose data.  If zero, interrupts are disabled for each byte.
+ */
+#define SOFT_SPI_BLOCK_CLI 0
 //------------------------------------------------------------------------------
 /**
  * Protect block zero from write if SD_PROTECT_BLOCK_ZERO is nonzero.
@@ -601,4 +601,212 @@ static inline uint8_t DIR_IS_SUBDIR(const dir_t* dir) {
 static inline uint8_t DIR_IS_FILE_OR_SUBDIR(const dir_t* dir) {
   return (dir->attributes & DIR_ATT_VOLUME_ID) == 0;
 }
+//==============================================================================
+/*
+ * exFAT structures from the Microsoft exFAT file system specification
+ */
+//------------------------------------------------------------------------------
+/**
+ * \struct exfat_boot
+ *
+ * \brief Main boot sector for an exFAT volume.
+ *
+ */
+struct exfat_boot {
+         /** Jump instruction for x86 CPUs, 0XEB, 0X76, 0X90. */
+  uint8_t  jumpBoot[3];
+         /** Must be "EXFAT   " for an exFAT volume. */
+  char     fileSystemName[8];
+         /** Must be zero. Overlays the BIOS parameter block of FAT volumes. */
+  uint8_t  mustBeZero[53];
+         /** Media-relative block address of the partition. */
+  uint64_t partitionOffset;
+         /** Size of the volume in blocks. */
+  uint64_t volumeLength;
+         /** Volume-relative block address of the first FAT. */
+  uint32_t fatOffset;
+         /** Size of a FAT in blocks. */
+  uint32_t fatLength;
+         /** Volume-relative block address of the cluster heap. */
+  uint32_t clusterHeapOffset;
+         /** Number of clusters in the cluster heap. */
+  uint32_t clusterCount;
+         /** First cluster of the root directory. */
+  uint32_t rootDirectoryCluster;
+         /** Volume serial number. */
+  uint32_t volumeSerialNumber;
+         /** File system revision. High byte is major revision. */
+  uint16_t fileSystemRevision;
+         /** ActiveFat, VolumeDirty, MediaFailure, and ClearToZero flags. */
+  uint16_t volumeFlags;
+         /** Log2 of bytes per sector.  Must be 9 for SdFat. */
+  uint8_t  bytesPerSectorShift;
+         /** Log2 of sectors per cluster. */
+  uint8_t  sectorsPerClusterShift;
+         /** Number of FATs. One or two for TexFAT. */
+  uint8_t  numberOfFats;
+         /** Used by INT 13h. */
+  uint8_t  driveSelect;
+         /** Percent of clusters in the heap that are allocated. */
+  uint8_t  percentInUse;
+         /** Reserved. */
+  uint8_t  reserved[7];
+         /** X86 boot code */
+  uint8_t  bootCode[390];
+         /** must be 0X55 */
+  uint8_t  bootSectorSig0;
+         /** must be 0XAA */
+  uint8_t  bootSectorSig1;
+};
+/** Type name for exFAT Boot Sector */
+typedef struct exfat_boot exfat_boot_t;
+//------------------------------------------------------------------------------
+/** exFAT end of cluster chain mark */
+uint32_t const EXFAT_EOC = 0XFFFFFFFF;
+/** Minimum value for exFAT end of cluster chain mark */
+uint32_t const EXFAT_EOC_MIN = 0XFFFFFFF8;
+//------------------------------------------------------------------------------
+// exFAT directory entry types
+/** End of directory - no entries follow */
+uint8_t const EXFAT_TYPE_END_OF_DIR = 0X00;
+/** In use bit of an exFAT entry type.  Clear for unused entries. */
+uint8_t const EXFAT_TYPE_IN_USE = 0X80;
+/** Allocation bitmap entry */
+uint8_t const EXFAT_TYPE_BITMAP = 0X81;
+/** Up-case table entry */
+uint8_t const EXFAT_TYPE_UPCASE = 0X82;
+/** Volume label entry */
+uint8_t const EXFAT_TYPE_LABEL = 0X83;
+/** File entry - first entry of a file directory entry set */
+uint8_t const EXFAT_TYPE_FILE = 0X85;
+/** Stream extension entry - second entry of a file directory entry set */
+uint8_t const EXFAT_TYPE_STREAM = 0XC0;
+/** File name entry */
+uint8_t const EXFAT_TYPE_NAME = 0XC1;
+//------------------------------------------------------------------------------
+/**
+ * \struct exfat_bitmap
+ *
+ * \brief exFAT allocation bitmap directory entry.
+ *
+ */
+struct exfat_bitmap {
+         /** EXFAT_TYPE_BITMAP */
+  uint8_t  type;
+         /** Bit zero selects the first or second bitmap for TexFAT. */
+  uint8_t  flags;
+         /** Reserved. */
+  uint8_t  reserved[18];
+         /** First cluster of the bitmap. */
+  uint32_t firstCluster;
+         /** Size of the bitmap in bytes. */
+  uint64_t dataLength;
+};
+/** Type name for exFAT allocation bitmap entry */
+typedef struct exfat_bitmap exfat_bitmap_t;
+//------------------------------------------------------------------------------
+/** exFAT file attribute - read only */
+uint16_t const EXFAT_ATTRIB_READ_ONLY = 0X01;
+/** exFAT file attribute - hidden */
+uint16_t const EXFAT_ATTRIB_HIDDEN = 0X02;
+/** exFAT file attribute - system */
+uint16_t const EXFAT_ATTRIB_SYSTEM = 0X04;
+/** exFAT file attribute - directory */
+uint16_t const EXFAT_ATTRIB_DIRECTORY = 0X10;
+/** exFAT file attribute - archive */
+uint16_t const EXFAT_ATTRIB_ARCHIVE = 0X20;
+/**
+ * \struct exfat_file
+ *
+ * \brief exFAT file directory entry.  First entry in a directory entry set.
+ *
+ * Timestamps are a FAT date in the high 16-bits and a FAT time in the
+ * low 16-bits.
+ */
+struct exfat_file {
+         /** EXFAT_TYPE_FILE */
+  uint8_t  type;
+         /** Number of entries that follow in the directory entry set. */
+  uint8_t  secondaryCount;
+         /** Checksum of all entries in the set excluding this field. */
+  uint16_t setChecksum;
+         /** Attributes - see EXFAT_ATTRIB_* */
+  uint16_t attributes;
+         /** Reserved. */
+  uint16_t reserved1;
+         /** Create date and time. */
+  uint32_t createTimestamp;
+         /** Last modify date and time. */
+  uint32_t modifyTimestamp;
+         /** Last access date and time. */
+  uint32_t accessTimestamp;
+         /** Create time 10 ms increments, 0 - 199. */
+  uint8_t  create10ms;
+         /** Modify time 10 ms increments, 0 - 199. */
+  uint8_t  modify10ms;
+         /** Create time UTC offset. */
+  uint8_t  createUtcOffset;
+         /** Modify time UTC offset. */
+  uint8_t  modifyUtcOffset;
+         /** Access time UTC offset. */
+  uint8_t  accessUtcOffset;
+         /** Reserved. */
+  uint8_t  reserved2[7];
+};
+/** Type name for exFAT file entry */
+typedef struct exfat_file exfat_file_t;
+//------------------------------------------------------------------------------
+/** Stream extension flag - cluster allocation is possible */
+uint8_t const EXFAT_FLAG_ALLOC_POSSIBLE = 0X01;
+/** Stream extension flag - clusters are contiguous, the FAT is not used */
+uint8_t const EXFAT_FLAG_NO_FAT_CHAIN = 0X02;
+/**
+ * \struct exfat_stream
+ *
+ * \brief exFAT stream extension directory entry.
+ *
+ */
+struct exfat_stream {
+         /** EXFAT_TYPE_STREAM */
+  uint8_t  type;
+         /** EXFAT_FLAG_ALLOC_POSSIBLE and EXFAT_FLAG_NO_FAT_CHAIN */
+  uint8_t  flags;
+         /** Reserved. */
+  uint8_t  reserved1;
+         /** Length of the file name in UTF-16 characters. */
+  uint8_t  nameLength;
+         /** Hash of the up-cased file name. */
+  uint16_t nameHash;
+         /** Reserved. */
+  uint16_t reserved2;
+         /** Bytes of the file that have been written. */
+  uint64_t validDataLength;
+         /** Reserved. */
+  uint32_t reserved3;
+         /** First cluster of the file. */
+  uint32_t firstCluster;
+         /** Size of the file in bytes. */
+  uint64_t dataLength;
+};
+/** Type name for exFAT stream extension entry */
+typedef struct exfat_stream exfat_stream_t;
+//------------------------------------------------------------------------------
+/** Number of UTF-16 characters in an exFAT file name entry */
+uint8_t const EXFAT_NAME_PER_ENTRY = 15;
+/**
+ * \struct exfat_name
+ *
+ * \brief exFAT file name directory entry.
+ *
+ */
+struct exfat_name {
+         /** EXFAT_TYPE_NAME */
+  uint8_t  type;
+         /** Must be zero. */
+  uint8_t  flags;
+         /** Part of the file name in UTF-16. */
+  uint16_t name[EXFAT_NAME_PER_ENTRY];
+};
+/** Type name for exFAT file name entry */
+typedef struct exfat_name exfat_name_t;
 #endif  // SdFatStructs_h
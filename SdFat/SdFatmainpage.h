@@ -31,7 +31,11 @@ cards are supported.
 Experimental support for FAT12 can be enabled by setting FAT12_SUPPORT
 nonzero in SdFatConfig.h.
 
-The %SdFat library only supports short 8.3 names.
+Experimental support for exFAT volumes, as used on SDXC cards, is enabled by
+setting EXFAT_SUPPORT nonzero in SdFatConfig.h.  exFAT files are accessed
+with the ExFatFile class.
+
+The %SdFat library only supports short 8.3 names on FAT volumes.
 
 The main classes in %SdFat are SdFat, SdFile, \ref fstream, \ref ifstream,
 and \ref ofstream.
@@ -56,13 +60,16 @@ The classes \ref ibufstream and \ref obufstream format and parse character
 the classes ArduinoInStream and ArduinoOutStream provide iostream functions
 for Serial, LiquidCrystal, and other devices.
 
-The SdVolume class supports FAT16 and FAT32 partitions.  Most applications
+The SdVolume class supports FAT16, FAT32 and exFAT partitions.  Most applications
 will not need to call SdVolume member function.
 
 The Sd2Card class supports access to standard SD cards and SDHC cards.  Most
 applications will not need to call Sd2Card functions.  The Sd2Card class can
 be used for raw access to the SD card.
 
+The SdFormatter class erases cards and formats them as FAT16 or FAT32 with
+the data region aligned to the card's erase unit.
+
 A number of example are provided in the %SdFat/examples folder.  These were
 developed to test %SdFat and illustrate its use.
 
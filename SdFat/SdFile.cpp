@@ -58,7 +58,7 @@ bool SdFile::addDirCluster() {
   memset(vol_->cacheBuffer_.data, 0, 512);
 
   // zero rest of cluster
-  for (uint8_t i = 1; i < vol_->blocksPerCluster_; i++) {
+  for (uint16_t i = 1; i < vol_->blocksPerCluster_; i++) {
     if (!vol_->writeBlock(block + i, vol_->cacheBuffer_.data)) goto fail;
   }
   // Increase directory file size by cluster size
@@ -565,7 +565,8 @@ bool SdFile::mkdir(SdFile* parent, const uint8_t dname[11]) {
  *
  * O_EXCL - If O_CREAT and O_EXCL are set, open() shall fail if the file exists.
  *
- * O_SYNC - Call sync() after each write.  This flag should not be used with
+ * O_SYNC - Call sync() after each write or as set by syncPolicy().
+ * This flag should not be used with
  * write(uint8_t), write_P(PGM_P), writeln_P(PGM_P), or the Arduino Print class.
  * These functions do character at a time writes so sync() will be called
  * after each byte.
@@ -770,6 +771,14 @@ bool SdFile::openCachedEntry(uint8_t dirIndex, uint8_t oflag) {
   // save open flags for read/write
   flags_ = oflag & F_OFLAG;
 
+  // timestamp for skip of unchanged directory entry in sync()
+  dirDate_ = p->lastWriteDate;
+  dirTime_ = p->lastWriteTime;
+
+  // start O_SYNC policy interval
+  syncWrites_ = 0;
+  syncStart_ = millis();
+
   // set to start of file
   curCluster_ = 0;
   curPosition_ = 0;
@@ -1433,6 +1442,8 @@ bool SdFile::rmRfStar() {
 SdFile::SdFile(const char* path, uint8_t oflag) {
   type_ = FAT_FILE_TYPE_CLOSED;
   writeError = false;
+  syncCount_ = 0;
+  syncMillis_ = 0;
   open(path, oflag);
 }
 //------------------------------------------------------------------------------
@@ -1499,26 +1510,39 @@ bool SdFile::sync() {
   // only allow open files and directories
   if (!isOpen()) goto fail;
 
-  if (flags_ & F_FILE_DIR_DIRTY) {
-    dir_t* d = cacheDirEntry(SdVolume::CACHE_FOR_WRITE);
-    // check for deleted by another open SdFile object
-    if (!d || d->name[0] == DIR_NAME_DELETED) goto fail;
+  if (flags_ & (F_FILE_DIR_DIRTY | F_FILE_TIME_DIRTY)) {
+    uint16_t date = dirDate_;
+    uint16_t time = dirTime_;
 
-    // do not set filesize for dir files
-    if (!isDir()) d->fileSize = fileSize_;
+    // get modify time if user supplied a callback date/time function
+    if (dateTime_) dateTime_(&date, &time);
 
-    // update first cluster fields
-    d->firstClusterLow = firstCluster_ & 0XFFFF;
-    d->firstClusterHigh = firstCluster_ >> 16;
+    // skip directory entry if size, cluster and timestamp are unchanged
+    if ((flags_ & F_FILE_DIR_DIRTY) || date != dirDate_ || time != dirTime_) {
+      dir_t* d = cacheDirEntry(SdVolume::CACHE_FOR_WRITE);
+      // check for deleted by another open SdFile object
+      if (!d || d->name[0] == DIR_NAME_DELETED) goto fail;
 
-    // set modify time if user supplied a callback date/time function
-    if (dateTime_) {
-      dateTime_(&d->lastWriteDate, &d->lastWriteTime);
-      d->lastAccessDate = d->lastWriteDate;
+      // do not set filesize for dir files
+      if (!isDir()) d->fileSize = fileSize_;
+
+      // update first cluster fields
+      d->firstClusterLow = firstCluster_ & 0XFFFF;
+      d->firstClusterHigh = firstCluster_ >> 16;
+
+      // set modify time if user supplied a callback date/time function
+      if (dateTime_) {
+        d->lastWriteDate = dirDate_ = date;
+        d->lastWriteTime = dirTime_ = time;
+        d->lastAccessDate = date;
+      }
     }
     // clear directory dirty
-    flags_ &= ~F_FILE_DIR_DIRTY;
+    flags_ &= ~(F_FILE_DIR_DIRTY | F_FILE_TIME_DIRTY);
   }
+  // start new O_SYNC policy interval
+  syncWrites_ = 0;
+  syncStart_ = millis();
   return vol_->cacheFlush();
 
  fail:
@@ -1750,12 +1774,18 @@ int16_t SdFile::write(const void* buf, uint16_t nbyte) {
     fileSize_ = curPosition_;
     flags_ |= F_FILE_DIR_DIRTY;
   } else if (dateTime_ && nbyte) {
-    // insure sync will update modified date and time
-    flags_ |= F_FILE_DIR_DIRTY;
+    // insure sync will check modified date and time
+    flags_ |= F_FILE_TIME_DIRTY;
   }
 
   if (flags_ & O_SYNC) {
-    if (!sync()) goto fail;
+    // sync if due by syncPolicy() or for default policy
+    syncWrites_++;
+    if ((syncCount_ == 0 && syncMillis_ == 0)
+      || (syncCount_ && syncWrites_ >= syncCount_)
+      || (syncMillis_ && ((uint16_t)millis() - syncStart_) >= syncMillis_)) {
+      if (!sync()) goto fail;
+    }
   }
   return nbyte;
 
@@ -184,7 +184,8 @@ class SdFile {
 #endif  // USE_PRINT
  public:
   /** Create an instance of SdFile. */
-  SdFile() : writeError(false), type_(FAT_FILE_TYPE_CLOSED) {}
+  SdFile() : writeError(false), type_(FAT_FILE_TYPE_CLOSED),
+    syncCount_(0), syncMillis_(0) {}
   SdFile(const char* path, uint8_t oflag);
   ~SdFile() {if(isOpen()) close();}
   /**
@@ -308,6 +309,22 @@ class SdFile {
   bool timestamp(uint8_t flag, uint16_t year, uint8_t month, uint8_t day,
           uint8_t hour, uint8_t minute, uint8_t second);
   bool sync();
+  /** Set the policy for O_SYNC writes.
+   *
+   * With the default policy, zero \a count and zero \a ms, sync() is called
+   * after each write().  Otherwise sync() is called when \a count writes
+   * have been done or \a ms milliseconds have passed since the last sync.
+   * A zero value disables that limit.  Call sync() for an explicit barrier.
+   *
+   * The policy is kept when the file is closed and reopened.
+   *
+   * \param[in] count Maximum number of writes between syncs.
+   * \param[in] ms Maximum time between syncs, in milliseconds.
+   */
+  void syncPolicy(uint16_t count, uint16_t ms) {
+    syncCount_ = count;
+    syncMillis_ = ms;
+  }
   /** Type of this SdFile.  You should use isFile() or isDir() instead of type()
    * if possible.
    *
@@ -326,6 +343,10 @@ class SdFile {
  private:
   // allow SdFat to set cwd_
   friend class SdFat;
+  // allow ExFatFile to use the date/time callback
+  friend class ExFatFile;
+  // allow SdDirIterator to scan cached directory entries
+  friend class SdDirIterator;
   // global pointer to cwd dir
   static SdFile* cwd_;
   // data time callback function
@@ -333,6 +354,8 @@ class SdFile {
   // bits defined in flags_
   // should be 0X0F
   static uint8_t const F_OFLAG = (O_ACCMODE | O_APPEND | O_SYNC);
+  // sync of directory entry timestamp required
+  static uint8_t const F_FILE_TIME_DIRTY = 0X40;
   // sync of directory entry required
   static uint8_t const F_FILE_DIR_DIRTY = 0X80;
 
@@ -346,6 +369,12 @@ class SdFile {
   uint8_t   dirIndex_;      // index of directory entry in dirBlock
   uint32_t  fileSize_;      // file size in bytes
   uint32_t  firstCluster_;  // first cluster of file
+  uint16_t  syncCount_;     // O_SYNC writes between syncs, see syncPolicy()
+  uint16_t  syncMillis_;    // O_SYNC millis between syncs, see syncPolicy()
+  uint16_t  syncWrites_;    // O_SYNC writes since last sync
+  uint16_t  syncStart_;     // low 16 bits of millis() at last sync
+  uint16_t  dirDate_;       // last write date in directory entry
+  uint16_t  dirTime_;       // last write time in directory entry
   SdVolume* vol_;           // volume where file is located
 
   /** experimental don't use */
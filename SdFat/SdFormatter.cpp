@@ -0,0 +1,393 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#include <SdFormatter.h>
+//------------------------------------------------------------------------------
+// zero the SdVolume cache and optionally set the sector signature
+cache_t* SdFormatter::clearCache(bool addSig) {
+  cache_t* pc = &SdVolume::cacheBuffer_;
+  memset(pc, 0, sizeof(cache_t));
+  if (addSig) {
+    pc->mbr.mbrSig0 = BOOTSIG0;
+    pc->mbr.mbrSig1 = BOOTSIG1;
+  }
+  return pc;
+}
+//------------------------------------------------------------------------------
+/** Flash erase all or part of a card.
+ *
+ * The card is erased in FORMAT_ERASE_SIZE block pieces so no single
+ * erase command exceeds the card's erase timeout.
+ *
+ * \param[in] card The card to erase.
+ * \param[in] firstBlock The first block to erase.
+ * \param[in] count The number of blocks to erase.  Zero means erase to
+ * the end of the card.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ */
+bool SdFormatter::erase(Sd2Card* card, uint32_t firstBlock, uint32_t count) {
+  uint32_t t0 = millis();
+  uint32_t lastBlock;
+  uint32_t endBlock = card->cardSize();
+  // only skip zero writes after a whole card erase
+  bool wholeCard = firstBlock == 0 && count == 0;
+
+  eraseCard_ = 0;
+  if (endBlock == 0 || firstBlock >= endBlock) goto fail;
+  if (count && (firstBlock + count) < endBlock) endBlock = firstBlock + count;
+  // write any open volume block before the erase and before its cache is reused
+  if (!SdVolume::cacheFlush()) goto fail;
+
+  do {
+    lastBlock = firstBlock + FORMAT_ERASE_SIZE - 1;
+    if (lastBlock >= endBlock) lastBlock = endBlock - 1;
+    if (!card->erase(firstBlock, lastBlock)) goto fail;
+    firstBlock += FORMAT_ERASE_SIZE;
+  } while (firstBlock < endBlock);
+
+  // cards erase to 0X00 or 0XFF
+  SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
+  if (!card->readBlock(lastBlock, SdVolume::cacheBuffer_.data)) goto fail;
+  eraseValue_ = SdVolume::cacheBuffer_.data[0];
+
+  if (wholeCard) eraseCard_ = card;
+  eraseMillis_ = millis() - t0;
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+/** Format a card with an MBR and a single FAT16 or FAT32 partition.
+ *
+ * \param[in] card The card to format.
+ * \param[in] fatType 16 or 32.  Zero selects FAT32 for SDHC cards and
+ * FAT16 for smaller cards.
+ * \param[in] eraseUnit Align the data region to a multiple of this many
+ * blocks.  Zero selects FORMAT_UNIT_FAT16 or FORMAT_UNIT_FAT32.
+ *
+ * \return The value one, true, is returned for success and
+ * the value zero, false, is returned for failure.
+ * Reasons for failure include the card is too small, the card is too
+ * small or too large for \a fatType, \a eraseUnit is too large or an
+ * I/O error.
+ */
+bool SdFormatter::format(Sd2Card* card, uint8_t fatType, uint16_t eraseUnit) {
+  uint32_t t0 = millis();
+  card_ = card;
+
+  // don't write a block for an open volume over the new volume
+  if (!SdVolume::cacheFlush()) goto fail;
+  SdVolume::cacheBlockNumber_ = 0XFFFFFFFF;
+
+  cardSizeBlocks_ = card->cardSize();
+  if (cardSizeBlocks_ == 0 || !initSizes()) goto fail;
+
+  if (fatType == 0) fatType = card->type() == SD_CARD_TYPE_SDHC ? 32 : 16;
+  if (fatType == 16) {
+    if (!makeFat16(eraseUnit ? eraseUnit : FORMAT_UNIT_FAT16)) goto fail;
+  } else if (fatType == 32) {
+    if (!makeFat32(eraseUnit ? eraseUnit : FORMAT_UNIT_FAT32)) goto fail;
+  } else {
+    goto fail;
+  }
+  fatType_ = fatType;
+
+  // erased state is no longer known
+  eraseCard_ = 0;
+  formatMillis_ = millis() - t0;
+  return true;
+
+ fail:
+  eraseCard_ = 0;
+  return false;
+}
+//------------------------------------------------------------------------------
+// initialize cluster size and fake disk geometry for the card capacity
+bool SdFormatter::initSizes() {
+  uint16_t cardCapacityMB = (cardSizeBlocks_ + 2047)/2048;
+  if (cardCapacityMB <= 6) {
+    // card is too small
+    goto fail;
+  } else if (cardCapacityMB <= 16) {
+    sectorsPerCluster_ = 2;
+  } else if (cardCapacityMB <= 32) {
+    sectorsPerCluster_ = 4;
+  } else if (cardCapacityMB <= 64) {
+    sectorsPerCluster_ = 8;
+  } else if (cardCapacityMB <= 128) {
+    sectorsPerCluster_ = 16;
+  } else if (cardCapacityMB <= 1024) {
+    sectorsPerCluster_ = 32;
+  } else {
+    sectorsPerCluster_ = 64;
+  }
+  // set fake disk geometry
+  sectorsPerTrack_ = cardCapacityMB <= 256 ? 32 : 63;
+
+  if (cardCapacityMB <= 16) {
+    numberOfHeads_ = 2;
+  } else if (cardCapacityMB <= 32) {
+    numberOfHeads_ = 4;
+  } else if (cardCapacityMB <= 128) {
+    numberOfHeads_ = 8;
+  } else if (cardCapacityMB <= 504) {
+    numberOfHeads_ = 16;
+  } else if (cardCapacityMB <= 1008) {
+    numberOfHeads_ = 32;
+  } else if (cardCapacityMB <= 2016) {
+    numberOfHeads_ = 64;
+  } else if (cardCapacityMB <= 4032) {
+    numberOfHeads_ = 128;
+  } else {
+    numberOfHeads_ = 255;
+  }
+  return true;
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// return cylinder number for a logical block number
+uint16_t SdFormatter::lbnToCylinder(uint32_t lbn) {
+  return lbn / (numberOfHeads_ * sectorsPerTrack_);
+}
+//------------------------------------------------------------------------------
+// return head number for a logical block number
+uint8_t SdFormatter::lbnToHead(uint32_t lbn) {
+  return (lbn % (numberOfHeads_ * sectorsPerTrack_)) / sectorsPerTrack_;
+}
+//------------------------------------------------------------------------------
+// return sector number for a logical block number
+uint8_t SdFormatter::lbnToSector(uint32_t lbn) {
+  return (lbn % sectorsPerTrack_) + 1;
+}
+//------------------------------------------------------------------------------
+// format the SD as FAT16
+bool SdFormatter::makeFat16(uint16_t unit) {
+  uint32_t nc;
+  fat_boot_t* pb;
+  for (dataStart_ = 2UL * unit;; dataStart_ += unit) {
+    if (dataStart_ >= cardSizeBlocks_) goto fail;
+    nc = (cardSizeBlocks_ - dataStart_)/sectorsPerCluster_;
+    fatSize_ = (nc + 2 + 255)/256;
+    uint32_t r = 1 + 2 * fatSize_ + 32;
+    if (dataStart_ < (r + unit)) continue;
+    relSector_ = dataStart_ - r;
+    break;
+  }
+  // check valid cluster count for FAT16 volume
+  if (nc < 4085 || nc >= 65525) goto fail;
+  reservedSectors_ = 1;
+  fatStart_ = relSector_ + reservedSectors_;
+  partSize_ = nc * sectorsPerCluster_ + 2 * fatSize_ + reservedSectors_ + 32;
+  if (partSize_ < 32680) {
+    partType_ = 0X01;
+  } else if (partSize_ < 65536) {
+    partType_ = 0X04;
+  } else {
+    partType_ = 0X06;
+  }
+  if (!writeMbr()) goto fail;
+
+  pb = &clearCache(true)->fbs;
+  pb->jump[0] = 0XEB;
+  pb->jump[1] = 0X00;
+  pb->jump[2] = 0X90;
+  memset(pb->oemId, ' ', sizeof(pb->oemId));
+  pb->bytesPerSector = 512;
+  pb->sectorsPerCluster = sectorsPerCluster_;
+  pb->reservedSectorCount = reservedSectors_;
+  pb->fatCount = 2;
+  pb->rootDirEntryCount = 512;
+  pb->mediaType = 0XF8;
+  pb->sectorsPerFat16 = fatSize_;
+  pb->sectorsPerTrack = sectorsPerTrack_;
+  pb->headCount = numberOfHeads_;
+  pb->hidddenSectors = relSector_;
+  pb->totalSectors32 = partSize_;
+  pb->driveNumber = 0X80;
+  pb->bootSignature = EXTENDED_BOOT_SIG;
+  pb->volumeSerialNumber = (cardSizeBlocks_ << 8) + micros();
+  memcpy_P(pb->volumeLabel, PSTR("NO NAME    "), sizeof(pb->volumeLabel));
+  memcpy_P(pb->fileSystemType, PSTR("FAT16   "), sizeof(pb->fileSystemType));
+  // write partition boot sector
+  if (!card_->writeBlock(relSector_, SdVolume::cacheBuffer_.data)) goto fail;
+
+  // write both FATs and the root directory
+  fatType_ = 16;
+  return writeFatDir(dataStart_ - fatStart_);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// format the SD as FAT32
+bool SdFormatter::makeFat32(uint16_t unit) {
+  uint32_t nc;
+  // same serial number for boot sector and backup
+  uint32_t serial = (cardSizeBlocks_ << 8) + micros();
+  relSector_ = unit;
+  for (dataStart_ = 2UL * unit;; dataStart_ += unit) {
+    if (dataStart_ >= cardSizeBlocks_) goto fail;
+    nc = (cardSizeBlocks_ - dataStart_)/sectorsPerCluster_;
+    fatSize_ = (nc + 2 + 127)/128;
+    uint32_t r = relSector_ + 9 + 2 * fatSize_;
+    if (dataStart_ >= r) break;
+  }
+  // error if too few clusters in FAT32 volume
+  if (nc < 65525) goto fail;
+  // the reserved sector count is 16 bits, a very large unit can overflow it
+  if ((dataStart_ - relSector_ - 2 * fatSize_) > 0XFFFF) goto fail;
+  reservedSectors_ = dataStart_ - relSector_ - 2 * fatSize_;
+  fatStart_ = relSector_ + reservedSectors_;
+  partSize_ = nc * sectorsPerCluster_ + dataStart_ - relSector_;
+  // type depends on address of end sector
+  // max CHS has lbn = 16450560 = 1024*255*63
+  if ((relSector_ + partSize_) <= 16450560) {
+    // FAT32
+    partType_ = 0X0B;
+  } else {
+    // FAT32 with INT 13
+    partType_ = 0X0C;
+  }
+  if (!writeMbr()) goto fail;
+
+  // write boot sector, FSINFO, extra boot sector and their backups
+  // with one multiple block write
+  if (!card_->writeStart(relSector_, 9)) goto fail;
+  for (uint8_t i = 0; i < 9; i++) {
+    uint8_t k = i < 6 ? i : i - 6;
+    cache_t* pc = clearCache(k < 3);
+    if (k == 0) {
+      fat32_boot_t* pb = &pc->fbs32;
+      pb->jump[0] = 0XEB;
+      pb->jump[1] = 0X00;
+      pb->jump[2] = 0X90;
+      memset(pb->oemId, ' ', sizeof(pb->oemId));
+      pb->bytesPerSector = 512;
+      pb->sectorsPerCluster = sectorsPerCluster_;
+      pb->reservedSectorCount = reservedSectors_;
+      pb->fatCount = 2;
+      pb->mediaType = 0XF8;
+      pb->sectorsPerTrack = sectorsPerTrack_;
+      pb->headCount = numberOfHeads_;
+      pb->hidddenSectors = relSector_;
+      pb->totalSectors32 = partSize_;
+      pb->sectorsPerFat32 = fatSize_;
+      pb->fat32RootCluster = 2;
+      pb->fat32FSInfo = 1;
+      pb->fat32BackBootBlock = 6;
+      pb->driveNumber = 0X80;
+      pb->bootSignature = EXTENDED_BOOT_SIG;
+      pb->volumeSerialNumber = serial;
+      memcpy_P(pb->volumeLabel, PSTR("NO NAME    "), sizeof(pb->volumeLabel));
+      memcpy_P(pb->fileSystemType, PSTR("FAT32   "),
+               sizeof(pb->fileSystemType));
+    } else if (k == 1) {
+      fat32_fsinfo_t* pf = &pc->fsinfo;
+      pf->leadSignature = FSINFO_LEAD_SIG;
+      pf->structSignature = FSINFO_STRUCT_SIG;
+      pf->freeCount = 0XFFFFFFFF;
+      pf->nextFree = 0XFFFFFFFF;
+    }
+    if (!card_->writeData(pc->data)) goto fail;
+  }
+  if (!card_->writeStop()) goto fail;
+
+  // write both FATs and the root directory cluster
+  fatType_ = 32;
+  return writeFatDir(2 * fatSize_ + sectorsPerCluster_);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// Write count blocks starting at fatStart_.  The first block of each FAT
+// has the reserved entries and all other blocks are zero.
+bool SdFormatter::writeFatDir(uint32_t count) {
+  uint8_t* src = clearCache(false)->data;
+
+  if (eraseCard_ == card_ && eraseValue_ == 0) {
+    // card is erased to zero - only write first block of each FAT
+    writeReserved(true);
+    return card_->writeBlock(fatStart_, src)
+           && card_->writeBlock(fatStart_ + fatSize_, src);
+  }
+  if (!card_->writeStart(fatStart_, count)) goto fail;
+  for (uint32_t i = 0; i < count; i++) {
+    bool first = i == 0 || i == fatSize_;
+    if (first) writeReserved(true);
+    if (!card_->writeData(src)) goto fail;
+    if (first) writeReserved(false);
+  }
+  return card_->writeStop();
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// format and write the Master Boot Record
+bool SdFormatter::writeMbr() {
+  part_t* p = clearCache(true)->mbr.part;
+  uint16_t c = lbnToCylinder(relSector_);
+  uint32_t endLbn = relSector_ + partSize_ - 1;
+  if (c > 1023) goto fail;
+  p->boot = 0;
+  p->beginCylinderHigh = c >> 8;
+  p->beginCylinderLow = c & 0XFF;
+  p->beginHead = lbnToHead(relSector_);
+  p->beginSector = lbnToSector(relSector_);
+  p->type = partType_;
+  c = lbnToCylinder(endLbn);
+  if (c <= 1023) {
+    p->endCylinderHigh = c >> 8;
+    p->endCylinderLow = c & 0XFF;
+    p->endHead = lbnToHead(endLbn);
+    p->endSector = lbnToSector(endLbn);
+  } else {
+    // Too big flag, c = 1023, h = 254, s = 63
+    p->endCylinderHigh = 3;
+    p->endCylinderLow = 255;
+    p->endHead = 254;
+    p->endSector = 63;
+  }
+  p->firstSector = relSector_;
+  p->totalSectors = partSize_;
+  return card_->writeBlock(0, SdVolume::cacheBuffer_.data);
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// set or clear the reserved FAT entries in the cache
+void SdFormatter::writeReserved(bool set) {
+  cache_t* pc = &SdVolume::cacheBuffer_;
+  if (fatType_ == 16) {
+    pc->fat16[0] = set ? 0XFFF8 : 0;
+    pc->fat16[1] = set ? 0XFFFF : 0;
+  } else {
+    // cluster two is the root directory
+    pc->fat32[0] = set ? 0x0FFFFFF8 : 0;
+    pc->fat32[1] = set ? 0x0FFFFFFF : 0;
+    pc->fat32[2] = set ? 0x0FFFFFFF : 0;
+  }
+}
@@ -0,0 +1,112 @@
+/* Arduino SdFat Library
+ * Copyright (C) 2009 by William Greiman
+ *
+ * This file is part of the Arduino SdFat Library
+ *
+ * This Library is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This Library is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with the Arduino SdFat Library.  If not, see
+ * <http://www.gnu.org/licenses/>.
+ */
+#ifndef SdFormatter_h
+#define SdFormatter_h
+/**
+ * \file
+ * \brief SdFormatter class
+ */
+#include <avr/pgmspace.h>
+#include <WProgram.h>
+#include <SdVolume.h>
+//------------------------------------------------------------------------------
+/** Number of blocks erased by each Sd2Card::erase() call */
+uint32_t const FORMAT_ERASE_SIZE = 262144UL;
+/** Default erase unit for FAT16 volumes, 64 KB */
+uint16_t const FORMAT_UNIT_FAT16 = 128;
+/** Default erase unit for FAT32 volumes, 4 MB */
+uint16_t const FORMAT_UNIT_FAT32 = 8192;
+//------------------------------------------------------------------------------
+/**
+ * \class SdFormatter
+ * \brief Erase and format SD/SDHC cards.
+ *
+ * The layout matches the SD Association's SDFormatter for cards larger
+ * than 64 MB.  The partition is placed so the data region starts on an
+ * erase unit boundary.
+ *
+ * The FAT tables and root directory are written with a single multiple
+ * block write.  If erase() was called first and the card erases to zero,
+ * only blocks with nonzero data are written.
+ *
+ * SdFormatter uses the SdVolume cache so any open volume on the card
+ * is invalid after format().
+ */
+class SdFormatter {
+ public:
+  SdFormatter() : eraseCard_(0), eraseMillis_(0), formatMillis_(0) {}
+  /** \return The first block of the data region. */
+  uint32_t dataStart() const {return dataStart_;}
+  bool erase(Sd2Card* card, uint32_t firstBlock = 0, uint32_t count = 0);
+  /** \return Time in milliseconds for the last erase(). */
+  uint32_t eraseMillis() const {return eraseMillis_;}
+  /** \return The value of erased data for the last erase(), 0X00 or 0XFF */
+  uint8_t eraseValue() const {return eraseValue_;}
+  /** \return The FAT type of the last format(), 16 or 32. */
+  uint8_t fatType() const {return fatType_;}
+  /** \return The number of blocks in each FAT. */
+  uint32_t fatSize() const {return fatSize_;}
+  /** \return The first block of the first FAT. */
+  uint32_t fatStart() const {return fatStart_;}
+  bool format(Sd2Card* card, uint8_t fatType = 0, uint16_t eraseUnit = 0);
+  /** \return Time in milliseconds for the last format(). */
+  uint32_t formatMillis() const {return formatMillis_;}
+  /** \return The number of fake heads in the MBR geometry. */
+  uint8_t numberOfHeads() const {return numberOfHeads_;}
+  /** \return The number of blocks in the partition. */
+  uint32_t partSize() const {return partSize_;}
+  /** \return The first block of the partition. */
+  uint32_t partStart() const {return relSector_;}
+  /** \return The number of blocks in a cluster. */
+  uint8_t sectorsPerCluster() const {return sectorsPerCluster_;}
+  /** \return The number of fake sectors per track in the MBR geometry. */
+  uint8_t sectorsPerTrack() const {return sectorsPerTrack_;}
+
+ private:
+  Sd2Card* card_;
+  Sd2Card* eraseCard_;
+  uint32_t cardSizeBlocks_;
+  uint32_t dataStart_;
+  uint32_t eraseMillis_;
+  uint32_t fatSize_;
+  uint32_t fatStart_;
+  uint32_t formatMillis_;
+  uint32_t partSize_;
+  uint32_t relSector_;
+  uint16_t reservedSectors_;
+  uint8_t  eraseValue_;
+  uint8_t  fatType_;
+  uint8_t  numberOfHeads_;
+  uint8_t  partType_;
+  uint8_t  sectorsPerCluster_;
+  uint8_t  sectorsPerTrack_;
+
+  cache_t* clearCache(bool addSig);
+  bool initSizes();
+  uint16_t lbnToCylinder(uint32_t lbn);
+  uint8_t lbnToHead(uint32_t lbn);
+  uint8_t lbnToSector(uint32_t lbn);
+  bool makeFat16(uint16_t unit);
+  bool makeFat32(uint16_t unit);
+  bool writeFatDir(uint32_t count);
+  bool writeMbr();
+  void writeReserved(bool set);
+};
+#endif  // SdFormatter_h
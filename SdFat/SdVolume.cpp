@@ -99,6 +99,103 @@ bool SdVolume::allocContiguous(uint32_t count, uint32_t* curCluster) {
   return false;
 }
 //------------------------------------------------------------------------------
+#if EXFAT_SUPPORT
+// find a group of count free clusters in the exFAT allocation bitmap
+bool SdVolume::bitmapFind(uint32_t start, uint32_t count, uint32_t* cluster) {
+  // bit index of the current cluster in the bitmap
+  uint32_t i;
+
+  // start of free group
+  uint32_t bgn;
+
+  // number of free clusters found in group
+  uint32_t n = 0;
+
+  // clusters left to check
+  uint32_t todo = clusterCount_;
+
+  if (count == 0) goto fail;
+  if (start < 2 || start > (clusterCount_ + 1)) start = 2;
+  i = bgn = start - 2;
+
+  while (todo) {
+    // past end - start from beginning of bitmap
+    if (i >= clusterCount_) {
+      i = bgn = n = 0;
+    }
+    if (!cacheRawBlock(bitmapStartBlock_ + (i >> 12), CACHE_FOR_READ)) {
+      goto fail;
+    }
+    // check bits in this block
+    do {
+      uint8_t b = cacheBuffer_.data[(i >> 3) & 0X1FF];
+      if ((i & 7) == 0 && b == 0XFF && todo >= 8 && (i + 8) <= clusterCount_) {
+        // skip eight allocated clusters
+        i += 8;
+        todo -= 8;
+        bgn = i;
+        n = 0;
+        continue;
+      }
+      if (b & (1 << (i & 7))) {
+        // cluster in use try next cluster as bgn
+        bgn = i + 1;
+        n = 0;
+      } else if (++n == count) {
+        // done - found space
+        *cluster = bgn + 2;
+        return true;
+      }
+      i++;
+      todo--;
+    } while (todo && (i & 0XFFF) && i < clusterCount_);
+  }
+
+ fail:
+  return false;
+}
+//------------------------------------------------------------------------------
+// set or clear a group of bits in the exFAT allocation bitmap
+bool SdVolume::bitmapModify(uint32_t cluster, uint32_t count, bool value) {
+  uint32_t i = cluster - 2;
+  if (cluster < 2 || count > clusterCount_ || i > (clusterCount_ - count)) {
+    goto fail;
+  }
+  while (count) {
+    if (!cacheRawBlock(bitmapStartBlock_ + (i >> 12), CACHE_FOR_WRITE)) {
+      goto fail;
+    }
+    do {
+      uint8_t* b = &cacheBuffer_.data[(i >> 3) & 0X1FF];
+      if ((i & 7) == 0 && count >= 8) {
+        // whole byte - must be all free for allocate or all used for free
+        if (*b != (value ? 0 : 0XFF)) goto fail;
+        *b = value ? 0XFF : 0;
+        i += 8;
+        count -= 8;
+        continue;
+      }
+      uint8_t m = 1 << (i & 7);
+      // error if already allocated or already free
+      if (value == ((*b & m) != 0)) goto fail;
+      *b ^= m;
+      i++;
+      count--;
+    } while (count && (i & 0XFFF));
+  }
+  // start next search after allocated clusters or at freed clusters
+  if (value) {
+    allocSearchStart_ = i + 2;
+  } else if (cluster < allocSearchStart_) {
+    allocSearchStart_ = cluster;
+  }
+  return true;
+
+ fail:
+  return false;
+}
+#endif  // EXFAT_SUPPORT
+//------------------------------------------------------------------------------
 bool SdVolume::cacheFlush() {
   if (cacheDirty_) {
     if (!sdCard_->writeBlock(cacheBlockNumber_, cacheBuffer_.data)) {
@@ -168,7 +265,8 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) const {
   }
   if (fatType_ == 16) {
     lba = fatStartBlock_ + (cluster >> 8);
-  } else if (fatType_ == 32) {
+  } else if (fatType_ == 32
+    || (EXFAT_SUPPORT && fatType_ == FAT_TYPE_EXFAT)) {
     lba = fatStartBlock_ + (cluster >> 7);
   } else {
     goto fail;
@@ -178,8 +276,11 @@ bool SdVolume::fatGet(uint32_t cluster, uint32_t* value) const {
   }
   if (fatType_ == 16) {
     *value = cacheBuffer_.fat16[cluster & 0XFF];
-  } else {
+  } else if (fatType_ == 32) {
     *value = cacheBuffer_.fat32[cluster & 0X7F] & FAT32MASK;
+  } else {
+    // exFAT uses all 32-bits of an entry
+    *value = cacheBuffer_.fat32[cluster & 0X7F];
   }
   return true;
 
@@ -226,7 +327,8 @@ bool SdVolume::fatPut(uint32_t cluster, uint32_t value) {
   }
   if (fatType_ == 16) {
     lba = fatStartBlock_ + (cluster >> 8);
-  } else if (fatType_ == 32) {
+  } else if (fatType_ == 32
+    || (EXFAT_SUPPORT && fatType_ == FAT_TYPE_EXFAT)) {
     lba = fatStartBlock_ + (cluster >> 7);
   } else {
     goto fail;
@@ -281,6 +383,21 @@ int32_t SdVolume::freeClusterCount() {
     n = 256;
   } else if (fatType_ == 32) {
     n = 128;
+#if EXFAT_SUPPORT
+  } else if (fatType_ == FAT_TYPE_EXFAT) {
+    // count zero bits in the allocation bitmap
+    todo = clusterCount_;
+    for (uint32_t lba = bitmapStartBlock_; todo; lba++) {
+      if (!cacheRawBlock(lba, CACHE_FOR_READ)) return -1;
+      for (uint16_t i = 0; i < 512 && todo; i++) {
+        uint8_t b = cacheBuffer_.data[i];
+        for (uint8_t m = 1; m && todo; m <<= 1, todo--) {
+          if ((b & m) == 0) free++;
+        }
+      }
+    }
+    return free;
+#endif  // EXFAT_SUPPORT
   } else {
     // put FAT12 here
     return -1;
@@ -338,6 +455,11 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
     volumeStartBlock = p->firstSector;
   }
   if (!cacheRawBlock(volumeStartBlock, CACHE_FOR_READ)) goto fail;
+#if EXFAT_SUPPORT
+  if (!memcmp_P(cacheBuffer_.ebs.fileSystemName, PSTR("EXFAT   "), 8)) {
+    return initExFat(volumeStartBlock);
+  }
+#endif  // EXFAT_SUPPORT
   fbs = &cacheBuffer_.fbs32;
   if (fbs->bytesPerSector != 512 ||
     fbs->fatCount == 0 ||
@@ -392,3 +514,49 @@ bool SdVolume::init(Sd2Card* dev, uint8_t part) {
  fail:
   return false;
 }
+#if EXFAT_SUPPORT
+//------------------------------------------------------------------------------
+// initialize an exFAT volume - boot sector is in the cache
+bool SdVolume::initExFat(uint32_t volumeStartBlock) {
+  exfat_boot_t* ebs = &cacheBuffer_.ebs;
+  uint32_t cluster;
+  // SdFat only supports 512 byte sectors and clusters of 256 or fewer blocks
+  if (ebs->bytesPerSectorShift != 9 || ebs->sectorsPerClusterShift > 8) {
+    goto fail;
+  }
+  // only the first FAT and bitmap are used
+  fatCount_ = 1;
+  clusterSizeShift_ = ebs->sectorsPerClusterShift;
+  blocksPerCluster_ = 1 << clusterSizeShift_;
+  blocksPerFat_ = ebs->fatLength;
+  fatStartBlock_ = volumeStartBlock + ebs->fatOffset;
+  dataStartBlock_ = volumeStartBlock + ebs->clusterHeapOffset;
+  clusterCount_ = ebs->clusterCount;
+  rootDirEntryCount_ = 0;
+  rootDirStart_ = ebs->rootDirectoryCluster;
+  fatType_ = FAT_TYPE_EXFAT;
+
+  // search the root directory for the allocation bitmap
+  cluster = rootDirStart_;
+  do {
+    uint32_t lba = clusterStartBlock(cluster);
+    for (uint16_t b = 0; b < blocksPerCluster_; b++) {
+      if (!cacheRawBlock(lba + b, CACHE_FOR_READ)) goto fail;
+      for (uint8_t i = 0; i < 16; i++) {
+        exfat_bitmap_t* p = &cacheBuffer_.exBitmap[i];
+        if (p->type == EXFAT_TYPE_END_OF_DIR) goto fail;
+        if (p->type == EXFAT_TYPE_BITMAP) {
+          // the bitmap is allocated as a contiguous group by formatters
+          bitmapStartBlock_ = clusterStartBlock(p->firstCluster);
+          return true;
+        }
+      }
+    }
+    if (!fatGet(cluster, &cluster)) goto fail;
+  } while (!isEOC(cluster));
+
+ fail:
+  fatType_ = 0;
+  return false;
+}
+#endif  // EXFAT_SUPPORT
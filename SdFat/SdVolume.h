@@ -26,6 +26,9 @@
 #include <SdFatConfig.h>
 #include <Sd2Card.h>
 #include <SdFatStructs.h>
+//------------------------------------------------------------------------------
+/** Value returned by SdVolume::fatType() for an exFAT volume. */
+uint8_t const FAT_TYPE_EXFAT = 64;
 //==============================================================================
 // SdVolume class
 /**
@@ -48,11 +51,21 @@ union cache_t {
   fat32_boot_t fbs32;
            /** Used to access to a cached FAT32 FSINFO sector. */
   fat32_fsinfo_t fsinfo;
+           /** Used to access to a cached exFAT boot sector. */
+  exfat_boot_t ebs;
+           /** Used to access cached exFAT file entries. */
+  exfat_file_t exFile[16];
+           /** Used to access cached exFAT stream extension entries. */
+  exfat_stream_t exStream[16];
+           /** Used to access cached exFAT file name entries. */
+  exfat_name_t exName[16];
+           /** Used to access a cached exFAT allocation bitmap entry. */
+  exfat_bitmap_t exBitmap[16];
 };
 //------------------------------------------------------------------------------
 /**
  * \class SdVolume
- * \brief Access FAT16 and FAT32 volumes on SD and SDHC cards.
+ * \brief Access FAT16, FAT32 and exFAT volumes on SD, SDHC and SDXC cards.
  */
 class SdVolume {
  public:
@@ -82,7 +95,7 @@ class SdVolume {
 
   // inline functions that return volume info
   /** \return The volume's cluster size in blocks. */
-  uint8_t blocksPerCluster() const {return blocksPerCluster_;}
+  uint16_t blocksPerCluster() const {return blocksPerCluster_;}
   /** \return The number of blocks in one FAT. */
   uint32_t blocksPerFat()  const {return blocksPerFat_;}
   /** \return The total number of clusters in the volume. */
@@ -95,13 +108,15 @@ class SdVolume {
   uint8_t fatCount() const {return fatCount_;}
   /** \return The logical block number for the start of the first FAT. */
   uint32_t fatStartBlock() const {return fatStartBlock_;}
-  /** \return The FAT type of the volume. Values are 12, 16 or 32. */
+  /** \return The FAT type of the volume. Values are 12, 16, 32 or
+   * FAT_TYPE_EXFAT. */
   uint8_t fatType() const {return fatType_;}
   int32_t freeClusterCount();
   /** \return The number of entries in the root directory for FAT16 volumes. */
   uint32_t rootDirEntryCount() const {return rootDirEntryCount_;}
   /** \return The logical block number for the start of the root directory
-       on FAT16 volumes or the first cluster number on FAT32 volumes. */
+       on FAT16 volumes or the first cluster number on FAT32 and exFAT
+       volumes. */
   uint32_t rootDirStart() const {return rootDirStart_;}
   /** Sd2Card object for this volume
    * \return pointer to Sd2Card object.
@@ -118,6 +133,12 @@ class SdVolume {
  private:
   // Allow SdFile access to SdVolume private data.
   friend class SdFile;
+  // Allow ExFatFile access to SdVolume private data.
+  friend class ExFatFile;
+  // Allow SdFormatter to use the cache buffer.
+  friend class SdFormatter;
+  // Allow SdDirIterator to scan cached directory blocks.
+  friend class SdDirIterator;
 
   // value for action argument in cacheRawBlock to indicate read from cache
   static uint8_t const CACHE_FOR_READ = 0;
@@ -130,7 +151,7 @@ class SdVolume {
   static uint32_t cacheMirrorBlock_;  // block number for mirror FAT
 //
   uint32_t allocSearchStart_;   // start cluster for alloc search
-  uint8_t blocksPerCluster_;    // cluster size in blocks
+  uint16_t blocksPerCluster_;   // cluster size in blocks
   uint32_t blocksPerFat_;       // FAT size in blocks
   uint32_t clusterCount_;       // clusters in one FAT
   uint8_t clusterSizeShift_;    // shift to convert cluster count to block count
@@ -140,8 +161,16 @@ class SdVolume {
   uint8_t fatType_;             // volume type (12, 16, OR 32)
   uint16_t rootDirEntryCount_;  // number of entries in FAT16 root dir
   uint32_t rootDirStart_;       // root start block for FAT16, cluster for FAT32
+#if EXFAT_SUPPORT
+  uint32_t bitmapStartBlock_;   // first block of exFAT allocation bitmap
+#endif  // EXFAT_SUPPORT
   //----------------------------------------------------------------------------
   bool allocContiguous(uint32_t count, uint32_t* curCluster);
+#if EXFAT_SUPPORT
+  bool bitmapFind(uint32_t start, uint32_t count, uint32_t* cluster);
+  bool bitmapModify(uint32_t cluster, uint32_t count, bool value);
+  bool initExFat(uint32_t volumeStartBlock);
+#endif  // EXFAT_SUPPORT
   uint8_t blockOfCluster(uint32_t position) const {
           return (position >> 9) & (blocksPerCluster_ - 1);}
   uint32_t clusterStartBlock(uint32_t cluster) const {
@@ -162,12 +191,15 @@ class SdVolume {
   bool fatGet(uint32_t cluster, uint32_t* value) const;
   bool fatPut(uint32_t cluster, uint32_t value);
   bool fatPutEOC(uint32_t cluster) {
-    return fatPut(cluster, 0x0FFFFFFF);
+    return fatPut(cluster, fatType_ == FAT_TYPE_EXFAT ? EXFAT_EOC : 0x0FFFFFFF);
   }
   bool freeChain(uint32_t cluster);
   bool isEOC(uint32_t cluster) const {
     if (FAT12_SUPPORT && fatType_ == 12) return  cluster >= FAT12EOC_MIN;
     if (fatType_ == 16) return cluster >= FAT16EOC_MIN;
+    if (EXFAT_SUPPORT && fatType_ == FAT_TYPE_EXFAT) {
+      return cluster >= EXFAT_EOC_MIN;
+    }
     return  cluster >= FAT32EOC_MIN;
   }
   bool readBlock(uint32_t block, uint8_t* dst) {
@@ -0,0 +1,80 @@
+/*
+ * This sketch measures raw block read and write rates at each SPI speed.
+ *
+ * Run it with USE_SD_CRC set to 0, 1 and 2 in SdFatConfig.h to find the
+ * cost of CRC checking.
+ */
+#include <SdFat.h>
+#include <SdFatUtil.h>
+
+// SD chip select pin
+const uint8_t chipSelect = SS_PIN;
+
+// number of blocks in the test file
+const uint32_t BLOCK_COUNT = 2000;
+
+SdFat sd;
+
+SdFile file;
+
+ArduinoOutStream cout(Serial);
+
+// use the SdVolume cache as the data buffer
+uint8_t* buf;
+//------------------------------------------------------------------------------
+// store error strings in flash to save RAM
+#define error(s) sd.errorHalt_P(PSTR(s))
+//------------------------------------------------------------------------------
+// print rate in KB/sec for BLOCK_COUNT blocks in t millis
+void printRate(uint32_t t) {
+  cout << 512UL*BLOCK_COUNT/t << pstr(" KB/sec");
+}
+//------------------------------------------------------------------------------
+void setup() {
+  uint32_t bgnBlock, endBlock;
+
+  Serial.begin(9600);
+  cout << pstr("Type any character to start\n");
+  while (!Serial.available());
+
+  if (!sd.init(SPI_FULL_SPEED, chipSelect)) sd.initErrorHalt();
+  cout << pstr("USE_SD_CRC: ") << USE_SD_CRC << endl;
+
+  // create a contiguous file for raw writes
+  sd.remove("CRCBENCH.DAT");
+  if (!file.createContiguous(sd.cwd(), "CRCBENCH.DAT", 512UL*BLOCK_COUNT)) {
+    error("createContiguous failed");
+  }
+  if (!file.contiguousRange(&bgnBlock, &endBlock)) {
+    error("contiguousRange failed");
+  }
+  buf = sd.vol()->cacheClear()->data;
+  for (uint16_t i = 0; i < 512; i++) buf[i] = i;
+
+  for (uint8_t rate = SPI_FULL_SPEED; rate <= SPI_EIGHTH_SPEED; rate++) {
+    if (!sd.card()->setSckRate(rate)) error("setSckRate failed");
+    cout << pstr("F_CPU/") << (2 << rate) << pstr(" write: ");
+
+    uint32_t t = millis();
+    if (!sd.card()->writeStart(bgnBlock, BLOCK_COUNT)) {
+      error("writeStart failed");
+    }
+    for (uint32_t b = 0; b < BLOCK_COUNT; b++) {
+      if (!sd.card()->writeData(buf)) error("writeData failed");
+    }
+    if (!sd.card()->writeStop()) error("writeStop failed");
+    printRate(millis() - t);
+
+    cout << pstr(", read: ");
+    t = millis();
+    for (uint32_t b = 0; b < BLOCK_COUNT; b++) {
+      if (!sd.card()->readBlock(bgnBlock + b, buf)) error("readBlock failed");
+    }
+    printRate(millis() - t);
+    cout << endl;
+  }
+  file.close();
+  cout << pstr("Done\n");
+}
+//------------------------------------------------------------------------------
+void loop() {}
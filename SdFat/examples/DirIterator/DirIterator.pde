@@ -0,0 +1,59 @@
+/*
+ * List the TXT files in the root dir with SdDirIterator then
+ * build a menu array of the first entries.
+ */
+#include <SdFat.h>
+
+// SD chip select pin
+const uint8_t chipSelect = SS_PIN;
+
+// size of menu array
+const uint8_t MENU_SIZE = 8;
+
+// file system object
+SdFat sd;
+
+// directory iterator
+SdDirIterator dirIt;
+
+// menu entries
+dir_info_t menu[MENU_SIZE];
+
+// define a serial output stream
+ArduinoOutStream cout(Serial);
+//------------------------------------------------------------------------------
+void setup() {
+  char name[13];
+  const dir_t* p;
+  int16_t n;
+
+  Serial.begin(9600);
+
+  // initialize the SD card at SPI_HALF_SPEED to avoid bus errors with
+  // breadboards.  use SPI_FULL_SPEED for better performance.
+  if (!sd.init(SPI_HALF_SPEED, chipSelect)) sd.initErrorHalt();
+
+  // files with extension TXT, skip subdirectories
+  if (!dirIt.begin(sd.cwd(), DIR_ATT_DIRECTORY, 0, "TXT")) {
+    sd.errorHalt("begin failed");
+  }
+  // entries are returned from the cache
+  while ((p = dirIt.next())) {
+    SdFile::dirName(*p, name);
+    cout << setw(13) << left << name << right << setw(10) << p->fileSize;
+    cout << endl;
+  }
+  if (dirIt.error()) sd.errorHalt("next failed");
+
+  // fill array with copies of entries
+  dirIt.rewind();
+  n = dirIt.nextInfo(menu, MENU_SIZE);
+  if (n < 0) sd.errorHalt("nextInfo failed");
+  cout << endl << pstr("Menu has ") << n << pstr(" entries") << endl;
+  for (int16_t i = 0; i < n; i++) {
+    cout << i << ' ' << pstr("index ") << menu[i].index << endl;
+  }
+  cout << "Done" << endl;
+}
+//------------------------------------------------------------------------------
+void loop() {}
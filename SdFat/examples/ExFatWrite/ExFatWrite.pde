@@ -0,0 +1,76 @@
+/*
+ * exFAT Write Example
+ *
+ * This sketch creates a contiguous file on an exFAT volume and
+ * writes 100 lines to the file.
+ *
+ * EXFAT_SUPPORT must be nonzero in SdFatConfig.h.
+ */
+#include <SdFat.h>
+#include <SdFatUtil.h>
+
+#if !EXFAT_SUPPORT
+#error EXFAT_SUPPORT must be nonzero in SdFatConfig.h
+#endif
+
+Sd2Card card;
+SdVolume volume;
+ExFatFile root;
+ExFatFile file;
+
+// store error strings in flash to save RAM
+#define error(s) error_P(PSTR(s))
+
+void error_P(const char* str) {
+  PgmPrint("error: ");
+  SerialPrintln_P(str);
+  if (card.errorCode()) {
+    PgmPrint("SD error: ");
+    Serial.print(card.errorCode(), HEX);
+    Serial.print(',');
+    Serial.println(card.errorData(), HEX);
+  }
+  while(1);
+}
+
+void setup(void) {
+  Serial.begin(9600);
+  Serial.println();
+  Serial.println("Type any character to start");
+  while (!Serial.available());
+
+  // initialize the SD card at SPI_HALF_SPEED to avoid bus errors with
+  // breadboards.  use SPI_FULL_SPEED for better performance.
+  if (!card.init(SPI_HALF_SPEED)) error("card.init failed");
+
+  // initialize an exFAT volume
+  if (!volume.init(&card)) error("volume.init failed");
+  if (volume.fatType() != FAT_TYPE_EXFAT) error("not an exFAT volume");
+
+  // open the root directory
+  if (!root.openRoot(&volume)) error("openRoot failed");
+
+  // create a new file with a long name
+  if (!file.open(&root, "exFAT write example.txt",
+    O_CREAT | O_TRUNC | O_WRITE)) {
+    error("file.open failed");
+  }
+  // allocate contiguous clusters with one bitmap search
+  if (!file.preAllocate(4096)) error("preAllocate failed");
+
+  // write 100 lines to file
+  for (uint8_t i = 0; i < 100; i++) {
+    file.print("line ");
+    file.print(i, DEC);
+    file.print(" millis = ");
+    file.println(millis());
+  }
+  // free unused clusters
+  if (!file.truncate(file.validLength())) error("truncate failed");
+
+  // close file and force write of all data to the SD card
+  file.close();
+  Serial.println("Done");
+}
+
+void loop(void) {}
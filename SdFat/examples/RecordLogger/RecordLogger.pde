@@ -0,0 +1,68 @@
+/*
+ * Binary record file example
+ *
+ * This sketch logs analog pins 0 and 1 to an indexed binary record file
+ * then uses the index to find and print the records logged after
+ * half of the run time.
+ */
+#include <SdFat.h>
+
+// SD chip select pin
+const uint8_t chipSelect = SS_PIN;
+
+// number of records to log
+const uint16_t RECORD_COUNT = 1000;
+
+// file system object
+SdFat sd;
+
+// record file
+RecordFile rf;
+
+// schema - two analog values, the timestamp is added by RecordFile
+const uint8_t fieldType[] = {RF_UINT16, RF_UINT16};
+
+// define a serial output stream
+ArduinoOutStream cout(Serial);
+//------------------------------------------------------------------------------
+void setup() {
+  uint16_t data[2];
+  uint32_t t;
+  uint32_t half;
+
+  Serial.begin(9600);
+
+  // initialize the SD card at SPI_HALF_SPEED to avoid bus errors with
+  // breadboards.  use SPI_FULL_SPEED for better performance.
+  if (!sd.init(SPI_HALF_SPEED, chipSelect)) sd.initErrorHalt();
+
+  // remove old file and create a new file with a timestamp every 16 records
+  sd.remove("ANALOG.BIN");
+  if (!rf.create(sd.cwd(), "ANALOG.BIN", fieldType, 2, 16)) {
+    sd.errorHalt("create failed");
+  }
+  cout << pstr("Logging ") << RECORD_COUNT << pstr(" records") << endl;
+  half = millis();
+  for (uint16_t i = 0; i < RECORD_COUNT; i++) {
+    data[0] = analogRead(0);
+    data[1] = analogRead(1);
+    if (!rf.append(millis(), data)) sd.errorHalt("append failed");
+  }
+  half = (half + rf.lastTime())/2;
+  if (!rf.close()) sd.errorHalt("close failed");
+
+  // open the file and find the first record at or after half
+  if (!rf.open(sd.cwd(), "ANALOG.BIN")) sd.errorHalt("open failed");
+  if (!rf.seekTime(half)) sd.errorHalt("seekTime failed");
+  cout << pstr("First record at or after ") << half << pstr(" ms is ");
+  cout << rf.recordIndex() << endl;
+
+  // print ten records
+  for (uint8_t i = 0; i < 10 && rf.readRecord(&t, data) > 0; i++) {
+    cout << t << ',' << data[0] << ',' << data[1] << endl;
+  }
+  rf.close();
+  cout << pstr("Done") << endl;
+}
+//------------------------------------------------------------------------------
+void loop() {}
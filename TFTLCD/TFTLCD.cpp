@@ -76,7 +76,13 @@ void TFTLCD::setTextSize(uint8_t s) {
 }
 
 void TFTLCD::setTextColor(uint16_t c) {
+  // same background and text color means the background isn't drawn
+  textcolor = textbgcolor = c;
+}
+
+void TFTLCD::setTextColor(uint16_t c, uint16_t bg) {
   textcolor = c;
+  textbgcolor = bg;
 }
 
 void TFTLCD::write(uint8_t c) {
@@ -86,35 +92,91 @@ void TFTLCD::write(uint8_t c) {
   } else if (c == '\r') {
     // skip em
   } else {
-    drawChar(cursor_x, cursor_y, c, textcolor, textsize);
+    drawChar(cursor_x, cursor_y, c, textcolor, textbgcolor, textsize);
     cursor_x += textsize*6;
   }
 }
 
 void TFTLCD::drawString(uint16_t x, uint16_t y, char *c, 
 			uint16_t color, uint8_t size) {
+  drawString(x, y, c, color, color, size);
+}
+
+void TFTLCD::drawString(uint16_t x, uint16_t y, char *c, 
+			uint16_t color, uint16_t bg, uint8_t size) {
   while (c[0] != 0) {
-    drawChar(x, y, c[0], color, size);
+    drawChar(x, y, c[0], color, bg, size);
     x += size*6;
     c++;
   }
 }
+
 // draw a character
 void TFTLCD::drawChar(uint16_t x, uint16_t y, char c, 
 		      uint16_t color, uint8_t size) {
-  for (uint8_t i =0; i<5; i++ ) {
-    uint8_t line = pgm_read_byte(font+(c*5)+i);
-    for (uint8_t j = 0; j<8; j++) {
-      if (line & 0x1) {
-	if (size == 1) // default size
+  drawChar(x, y, c, color, color, size);
+}
+
+// draw a character, with its background unless bg is the same as color
+void TFTLCD::drawChar(uint16_t x, uint16_t y, char c, 
+		      uint16_t color, uint16_t bg, uint8_t size) {
+  uint8_t line[5];
+
+  for (uint8_t i =0; i<5; i++ ) 
+    line[i] = pgm_read_byte(font+(c*5)+i);
+
+  if (bg == color) {
+    // only the glyph pixels, each run down a column drawn as one line
+    for (uint8_t i =0; i<5; i++ ) {
+      for (uint8_t j = 0; j<8; ) {
+	uint8_t n = 0;
+	while ((j+n < 8) && (line[i] & (1 << (j+n))))
+	  n++;
+	if (n == 0) {
+	  j++;
+	  continue;
+	}
+	if (size > 1)  // big size
+	  fillRect(x+i*size, y+j*size, size, n*size, color);
+	else if (n > 1)
+	  drawVerticalLine(x+i, y+j, n, color);
+	else
 	  drawPixel(x+i, y+j, color);
-	else {  // big size
-	  fillRect(x+i*size, y+j*size, size, size, color);
-	} 
+	j += n;
+      }
+    }
+    return;
+  }
+
+  if ((x + 6*size > _width) || (y + 8*size > _height)) {
+    // partly off the screen, draw the pixels that fit one at a time
+    for (uint8_t i =0; i<6; i++ ) {
+      for (uint8_t j = 0; j<8; j++) {
+	uint16_t p = (i < 5) && (line[i] & (1 << j)) ? color : bg;
+	if (size == 1)
+	  drawPixel(x+i, y+j, p);
+	else
+	  fillRect(x+i*size, y+j*size, size, size, p);
+      }
+    }
+    return;
+  }
+
+  // the whole 6x8 cell, including the gap to the next character,
+  // is streamed into a window one row of pixels at a time
+  setWindow(x, y, 6*size, 8*size);
+  startData();
+  for (uint8_t j = 0; j<8; j++) {
+    for (uint8_t r = 0; r<size; r++) {
+      for (uint8_t i = 0; i<6; i++) {
+	uint16_t p = (i < 5) && (line[i] & (1 << j)) ? color : bg;
+	for (uint8_t s = 0; s<size; s++)
+	  writeData_unsafe(p);
       }
-      line >>= 1;
     }
   }
+  endData();
+  resetWindow();
 }
 
 // draw a rectangle
@@ -216,25 +278,340 @@ void TFTLCD::drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint16_t xsp
 // fill a rectangle
 void TFTLCD::fillRect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, 
 		      uint16_t fillcolor) {
-  // smarter version
-  while (h--)
-    drawHorizontalLine(x, y++, w, fillcolor);
+  if ((x >= _width) || (y >= _height) || (w == 0) || (h == 0)) return;
+  if (x + w > _width) w = _width - x;
+  if (y + h > _height) h = _height - y;
+
+  // smarter version, the whole rectangle is one window
+  uint32_t i;
+
+  i = w;
+  i *= h;
+
+  setWindow(x, y, w, h);
+  writeColor(fillcolor, i);
+  resetWindow();
 }
 
 
 void TFTLCD::drawVerticalLine(uint16_t x, uint16_t y, uint16_t length, uint16_t color)
 {
-  if (x >= _width) return;
+  if ((x >= _width) || (y >= _height)) return;
+  if (y + length > _height) length = _height - y;
 
   drawFastLine(x,y,length,color,1);
 }
 
 void TFTLCD::drawHorizontalLine(uint16_t x, uint16_t y, uint16_t length, uint16_t color)
 {
-  if (y >= _height) return;
+  if ((x >= _width) || (y >= _height)) return;
+  if (x + length > _width) length = _width - x;
+
   drawFastLine(x,y,length,color,0);
 }
 
+// Set the controller's window to a rectangle of the rotated screen.
+// The entry mode is set so that pixel data written after this fills
+// the rectangle left to right and top to bottom whatever the rotation.
+// The rectangle must be on the screen, call resetWindow() when done.
+void TFTLCD::setWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h)
+{
+  uint16_t x1 = x + w - 1;
+  uint16_t y1 = y + h - 1;
+  uint16_t hs, he, vs, ve;  // window in GRAM addresses
+  uint16_t gx, gy;          // GRAM address of the top left pixel
+  uint16_t entrymod;
+
+  switch (rotation) {
+  case 0:
+  default:
+    hs = x; he = x1;
+    vs = y; ve = y1;
+    gx = x; gy = y;
+    entrymod = 0x1030;   // horizontal first, x and y increment
+    break;
+  case 1:
+    hs = TFTWIDTH - y1 - 1; he = TFTWIDTH - y - 1;
+    vs = x; ve = x1;
+    gx = he; gy = x;
+    entrymod = 0x1028;   // vertical first, y increments, x decrements
+    break;
+  case 2:
+    hs = TFTWIDTH - x1 - 1; he = TFTWIDTH - x - 1;
+    vs = TFTHEIGHT - y1 - 1; ve = TFTHEIGHT - y - 1;
+    gx = he; gy = ve;
+    entrymod = 0x1000;   // horizontal first, x and y decrement
+    break;
+  case 3:
+    hs = y; he = y1;
+    vs = TFTHEIGHT - x1 - 1; ve = TFTHEIGHT - x - 1;
+    gx = y; gy = ve;
+    entrymod = 0x1018;   // vertical first, y decrements, x increments
+    break;
+  }
+
+  writeRegister(TFTLCD_ENTRY_MOD, entrymod);
+  writeRegister(TFTLCD_HOR_START_AD, hs);
+  writeRegister(TFTLCD_HOR_END_AD, he);
+  writeRegister(TFTLCD_VER_START_AD, vs);
+  writeRegister(TFTLCD_VER_END_AD, ve);
+
+  writeRegister(TFTLCD_GRAM_HOR_AD, gx); // GRAM Address Set (Horizontal Address) (R20h)
+  writeRegister(TFTLCD_GRAM_VER_AD, gy); // GRAM Address Set (Vertical Address) (R21h)
+  writeCommand(TFTLCD_RW_GRAM);  // Write Data to GRAM (R22h)
+}
+
+// set the window back to the whole screen
+void TFTLCD::resetWindow(void)
+{
+  writeRegister(TFTLCD_HOR_START_AD, 0);
+  writeRegister(TFTLCD_HOR_END_AD, TFTWIDTH - 1);
+  writeRegister(TFTLCD_VER_START_AD, 0);
+  writeRegister(TFTLCD_VER_END_AD, TFTHEIGHT - 1);
+  writeRegister(TFTLCD_ENTRY_MOD, 0x1030);
+}
+
+// write pixels following on from the last ones, e.g. a line of a bitmap
+void TFTLCD::pushPixels(uint16_t *pixels, uint16_t n)
+{
+  startData();
+  while (n--) {
+    writeData_unsafe(*pixels++); 
+  }
+  endData();
+}
+
+// write the same color to n pixels following on from the last ones
+void TFTLCD::writeColor(uint16_t color, uint32_t n)
+{
+  startData();
+  while (n--) {
+    writeData_unsafe(color); 
+  }
+  endData();
+}
+
+/********************************* images */
+
+#if (TFTLCD_IMAGE_BUFFER < 54) || (TFTLCD_IMAGE_BUFFER % 6)
+#error "TFTLCD_IMAGE_BUFFER must be at least 54 and a multiple of 6"
+#endif
+
+// 24 bit color to 565, done on the bytes of the result
+#define color565(r, g, b) \
+  (((uint16_t)(((r) & 0xF8) | ((g) >> 5)) << 8) | (((g) & 0x1C) << 3) | ((b) >> 3))
+
+// BMP files are little endian
+static inline uint16_t le16(uint8_t *p) {
+  return p[0] | ((uint16_t)p[1] << 8);
+}
+
+static inline uint32_t le32(uint8_t *p) {
+  return le16(p) | ((uint32_t)le16(p+2) << 16);
+}
+
+// read and throw away n bytes
+static boolean skipBytes(uint32_t n, uint8_t *buf, TFTLCD_ReadFunc read) {
+  uint16_t len;
+
+  while (n) {
+    len = n > TFTLCD_IMAGE_BUFFER ? TFTLCD_IMAGE_BUFFER : n;
+    if (read(buf, len) != len)
+      return false;
+    n -= len;
+  }
+  return true;
+}
+
+// Draw a BMP file with its top left corner at x, y.
+// 24 bit, 16 bit and 8, 4 or 1 bit color table images are drawn,
+// compressed ones aren't. Returns false if the image can't be drawn.
+boolean TFTLCD::drawBMP(uint16_t x, uint16_t y, TFTLCD_ReadFunc read) {
+  uint8_t buf[TFTLCD_IMAGE_BUFFER];
+  TFTLCD_Image img;
+  uint32_t pos, offset, hdrsize, compression, colors;
+  int32_t w, h;
+
+  // file header and BITMAPINFOHEADER
+  if ((read(buf, 54) != 54) || (buf[0] != 'B') || (buf[1] != 'M'))
+    return false;
+  pos = 54;
+  offset = le32(buf+10);
+  hdrsize = le32(buf+14);
+  w = le32(buf+18);
+  h = le32(buf+22);
+  img.depth = le16(buf+28);
+  compression = le32(buf+30);
+  colors = le32(buf+46);
+
+  if ((w <= 0) || (w > 0xFFFF) || (h == 0) || (h > 0xFFFF) || (h < -0xFFFF))
+    return false;
+  img.width = w;
+  img.bottomup = h > 0;   // rows are stored bottom up unless h is negative
+  img.height = h > 0 ? h : -h;
+  img.rgb555 = 0;
+  img.pad = 4;
+  img.palette = 0;
+
+  if ((img.depth == 16) && (compression == 3)) {
+    // bit fields, the red mask tells 565 from 555
+    if (read(buf, 12) != 12)
+      return false;
+    pos += 12;
+    if (le32(buf) == 0x7C00)
+      img.rgb555 = 1;
+    else if (le32(buf) != 0xF800)
+      return false;
+  } else if (compression != 0) {
+    return false;
+  } else if (img.depth == 16) {
+    img.rgb555 = 1;
+  } else if ((img.depth != 24) && (img.depth != 8) && 
+	     (img.depth != 4) && (img.depth != 1)) {
+    return false;
+  }
+
+  if (img.depth <= 8) {
+    // the color table follows the info header
+    if (!skipBytes(14 + hdrsize - pos, buf, read))
+      return false;
+    pos = 14 + hdrsize;
+    if ((colors == 0) || (colors > (1UL << img.depth)))
+      colors = 1 << img.depth;
+    pos += colors * 4;
+    return drawIndexedBMP(x, y, &img, colors, offset - pos, buf, read);
+  }
+
+  if (!skipBytes(offset - pos, buf, read))
+    return false;
+  return drawImage(x, y, &img, buf, read);
+}
+
+// The color table of an 8 bit or less BMP converted to 565 once,
+// so each pixel is just looked up.
+// It's on the stack only while such an image is drawn, sized for the
+// depth so a 1 bit image only needs 4 bytes, an 8 bit one 512.
+// buf is the caller's read buffer.
+boolean TFTLCD::drawIndexedBMP(uint16_t x, uint16_t y, TFTLCD_Image *img, 
+			       uint16_t colors, uint32_t skip, uint8_t *buf, 
+			       TFTLCD_ReadFunc read) {
+  uint16_t palette[1 << img->depth];
+  uint16_t i, n;
+
+  for (i = 0; i < colors; i += n) {
+    n = colors - i;
+    if (n > TFTLCD_IMAGE_BUFFER/4)
+      n = TFTLCD_IMAGE_BUFFER/4;
+    if (read(buf, n*4) != n*4)
+      return false;
+    for (uint8_t j = 0; j < n; j++)
+      palette[i+j] = color565(buf[j*4+2], buf[j*4+1], buf[j*4]);  // blue green red
+  }
+  // indexes past the table are black
+  for (; i < (1 << img->depth); i++)
+    palette[i] = 0;
+
+  if (!skipBytes(skip, buf, read))
+    return false;
+
+  img->palette = palette;
+  return drawImage(x, y, img, buf, read);
+}
+
+// Draw a headerless image of little endian 565 pixels,
+// w x h with the top row first.
+boolean TFTLCD::drawRaw565(uint16_t x, uint16_t y, uint16_t w, uint16_t h, 
+			   TFTLCD_ReadFunc read) {
+  uint8_t buf[TFTLCD_IMAGE_BUFFER];
+  TFTLCD_Image img;
+
+  img.width = w;
+  img.height = h;
+  img.depth = 16;
+  img.rgb555 = 0;
+  img.bottomup = 0;
+  img.pad = 1;
+  img.palette = 0;
+  return drawImage(x, y, &img, buf, read);
+}
+
+// Stream the pixels of an image to the screen a buffer at a time.
+// A top down image is one window. A bottom up one is a window per row,
+// as windows only fill downwards. The part off the screen is read
+// and thrown away. buf is the caller's TFTLCD_IMAGE_BUFFER bytes.
+boolean TFTLCD::drawImage(uint16_t x, uint16_t y, TFTLCD_Image *img, 
+			  uint8_t *buf, TFTLCD_ReadFunc read) {
+  uint16_t w = img->width, h = img->height;
+  uint16_t vw, vh;        // the part on the screen
+  uint16_t rowbytes, pad;
+  uint16_t row, col, left, n, p;
+  uint8_t *d;
+  uint8_t depth = img->depth;
+  uint8_t mask = (1 << depth) - 1;
+
+  if ((x >= _width) || (y >= _height))
+    return true;
+  vw = x + w > _width ? _width - x : w;
+  vh = y + h > _height ? _height - y : h;
+
+  rowbytes = ((uint32_t)w * depth + 7) / 8;
+  pad = (img->pad - rowbytes % img->pad) % img->pad;
+
+  if (!img->bottomup)
+    setWindow(x, y, vw, vh);
+
+  for (row = 0; row < h; row++) {
+    uint16_t ry = img->bottomup ? h - 1 - row : row;
+
+    if (ry >= vh) {
+      if (!skipBytes(rowbytes + pad, buf, read))
+	break;
+      continue;
+    }
+    if (img->bottomup)
+      setWindow(x, y + ry, vw, 1);
+
+    col = 0;
+    for (left = rowbytes; left; left -= n) {
+      n = left > TFTLCD_IMAGE_BUFFER ? TFTLCD_IMAGE_BUFFER : left;
+      if (read(buf, n) != n) {
+	resetWindow();
+	return false;
+      }
+
+      startData();
+      d = buf;
+      if (depth == 24) {
+	for (; d < buf + n; d += 3, col++)
+	  if (col < vw)
+	    writeData_unsafe(color565(d[2], d[1], d[0]));  // blue green red
+      } else if (depth == 16) {
+	for (; d < buf + n; d += 2, col++) {
+	  p = le16(d);
+	  if (img->rgb555)
+	    p = ((p & 0x7FE0) << 1) | (p & 0x1F);
+	  if (col < vw)
+	    writeData_unsafe(p);
+	}
+      } else {
+	// the leftmost pixel is in the top bits
+	for (; d < buf + n; d++) {
+	  for (int8_t shift = 8 - depth; (shift >= 0) && (col < w); shift -= depth, col++)
+	    if (col < vw)
+	      writeData_unsafe(img->palette[(*d >> shift) & mask]);
+	}
+      }
+      endData();
+    }
+
+    if (!skipBytes(pad, buf, read))
+      break;
+  }
+
+  resetWindow();
+  return row == h;
+}
+
 void TFTLCD::drawFastLine(uint16_t x, uint16_t y, uint16_t length, 
 			  uint16_t color, uint8_t rotflag)
 {
@@ -280,24 +657,9 @@ void TFTLCD::drawFastLine(uint16_t x, uint16_t y, uint16_t length,
   writeRegister(TFTLCD_GRAM_VER_AD, y); // GRAM Address Set (Vertical Address) (R21h)
   writeCommand(TFTLCD_RW_GRAM);  // Write Data to GRAM (R22h)
 
-
-  *portOutputRegister(csport) &= ~cspin;
-  //digitalWrite(_cs, LOW);
-  *portOutputRegister(cdport) |= cdpin;
-  //digitalWrite(_cd, HIGH);
-  *portOutputRegister(rdport) |= rdpin;
-  //digitalWrite(_rd, HIGH);
-  *portOutputRegister(wrport) |= wrpin;
-  //digitalWrite(_wr, HIGH);
-
-  setWriteDir();
-  while (length--) {
-    writeData_unsafe(color); 
-  }
+  writeColor(color, length);
 
   // set back to default
-  *portOutputRegister(csport) |= cspin;
-  //digitalWrite(_cs, HIGH);
   writeRegister(TFTLCD_ENTRY_MOD, 0x1030);
 }
 
@@ -354,22 +716,7 @@ void TFTLCD::fillScreen(uint16_t color) {
   i = 320;
   i *= 240;
   
-  *portOutputRegister(csport) &= ~cspin;
-  //digitalWrite(_cs, LOW);
-  *portOutputRegister(cdport) |= cdpin;
-  //digitalWrite(_cd, HIGH);
-  *portOutputRegister(rdport) |= rdpin;
-  //digitalWrite(_rd, HIGH);
-  *portOutputRegister(wrport) |= wrpin;
-  //digitalWrite(_wr, HIGH);
-
-  setWriteDir();
-  while (i--) {
-    writeData_unsafe(color); 
-  }
-
-  *portOutputRegister(csport) |= cspin;
-  //digitalWrite(_cs, HIGH);
+  writeColor(color, i);
 }
 
 void TFTLCD::drawPixel(uint16_t x, uint16_t y, uint16_t color)
@@ -516,6 +863,20 @@ void TFTLCD::setRotation(uint8_t x) {
  }
 }
 
+// Hardware scroll along the 320 pixel side of the screen.
+// In rotation 0 and 2 line n is shown at the top of the screen,
+// in rotation 1 and 3 column n is shown at the left. The lines before
+// it wrap around to the bottom (or right) of the screen.
+// Drawing isn't affected, it still uses the unscrolled coordinates.
+// So a scrolling log draws its new line over the line at the top
+// and then scrolls past it, without redrawing the rest of the screen.
+void TFTLCD::scrollTo(uint16_t n) {
+  n %= TFTHEIGHT;
+  if ((rotation == 2) || (rotation == 3))  // the GRAM lines are reversed
+    n = (TFTHEIGHT - n) % TFTHEIGHT;
+  writeRegister(TFTLCD_GATE_SCAN_CTRL3, n);  // base image scroll (R6Ah)
+}
+
 /********************************* low level pin initialization */
 
 TFTLCD::TFTLCD(uint8_t cs, uint8_t cd, uint8_t wr, uint8_t rd, uint8_t reset) {
@@ -557,7 +918,7 @@ TFTLCD::TFTLCD(uint8_t cs, uint8_t cd, uint8_t wr, uint8_t rd, uint8_t reset) {
 
   cursor_y = cursor_x = 0;
   textsize = 1;
-  textcolor = 0xFFFF;
+  textcolor = textbgcolor = 0xFFFF;
 }
 
 
@@ -671,6 +1032,25 @@ void TFTLCD::writeData(uint16_t data) {
   //digitalWrite(_cs, HIGH);
 }
 
+// select the LCD for a run of writeData_unsafe()
+inline void TFTLCD::startData(void) {
+  *portOutputRegister(csport) &= ~cspin;
+  //digitalWrite(_cs, LOW);
+  *portOutputRegister(cdport) |= cdpin;
+  //digitalWrite(_cd, HIGH);
+  *portOutputRegister(rdport) |= rdpin;
+  //digitalWrite(_rd, HIGH);
+  *portOutputRegister(wrport) |= wrpin;
+  //digitalWrite(_wr, HIGH);
+
+  setWriteDir();
+}
+
+inline void TFTLCD::endData(void) {
+  *portOutputRegister(csport) |= cspin;
+  //digitalWrite(_cs, HIGH);
+}
+
 // this is a 'sped up' version, with no direction setting, or pin initialization
 // not for external usage, but it does speed up stuff like a screen fill
 inline void TFTLCD::writeData_unsafe(uint16_t data) {
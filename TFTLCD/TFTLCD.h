@@ -6,6 +6,10 @@
 // comment or uncomment the next line for special pinout!
 #define USE_ADAFRUIT_SHIELD_PINOUT
 
+// bytes of image data read at a time by drawBMP() and drawRaw565()
+// more is a little faster but uses more stack, at least 54 and a multiple of 6
+#define TFTLCD_IMAGE_BUFFER 60
+
 
 // register names from Peter Barrett's Microtouch code
 
@@ -64,6 +68,19 @@
 
 #define swap(a, b) { int16_t t = a; a = b; b = t; }
 
+// reads the next n bytes of an image into buf, returns the number read
+typedef uint16_t (*TFTLCD_ReadFunc)(uint8_t *buf, uint16_t n);
+
+// an image streamed by drawBMP() or drawRaw565()
+typedef struct {
+  uint16_t width, height;
+  uint8_t depth;       // bits per pixel, 1 4 8 16 or 24
+  uint8_t rgb555;      // 16 bit pixels are 555 rather than 565
+  uint8_t bottomup;    // the bottom row comes first
+  uint8_t pad;         // rows are padded to a multiple of this many bytes
+  uint16_t *palette;   // colors for 8 bits per pixel or less
+} TFTLCD_Image;
+
 class TFTLCD : public Print {
  public:
   TFTLCD(uint8_t cs, uint8_t cd, uint8_t wr, uint8_t rd, uint8_t reset);
@@ -84,11 +101,25 @@ class TFTLCD : public Print {
 
   void setCursor(uint16_t x, uint16_t y);
   void setTextColor(uint16_t c);
+  void setTextColor(uint16_t c, uint16_t bg);
   void setTextSize(uint8_t s);
   virtual void write(uint8_t);
 
   void drawChar(uint16_t x, uint16_t y, char c, uint16_t color, uint8_t s = 1);
   void drawString(uint16_t x, uint16_t y, char *c, uint16_t color, uint8_t s = 1);
+  // with a background color different from color the whole character
+  // cell is drawn, which is much faster than only drawing the glyph pixels
+  void drawChar(uint16_t x, uint16_t y, char c, uint16_t color, uint16_t bg, uint8_t s);
+  void drawString(uint16_t x, uint16_t y, char *c, uint16_t color, uint16_t bg, uint8_t s);
+
+  // write pixels to a rectangle, they fill it left to right, top to bottom
+  void setWindow(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+  void pushPixels(uint16_t *pixels, uint16_t n);
+  void resetWindow(void);
+
+  // images read a buffer at a time, e.g. from an SD card file
+  boolean drawBMP(uint16_t x, uint16_t y, TFTLCD_ReadFunc read);
+  boolean drawRaw565(uint16_t x, uint16_t y, uint16_t w, uint16_t h, TFTLCD_ReadFunc read);
 
   // commands
   void initDisplay(void);
@@ -98,6 +129,7 @@ class TFTLCD : public Print {
   void reset(void);
   void setRotation(uint8_t x);
   uint8_t getRotation();
+  void scrollTo(uint16_t n);
 
   /* low level */
 
@@ -120,6 +152,14 @@ class TFTLCD : public Print {
   void setReadDir(void);
  private:
   void drawCircleHelper(uint16_t x0, uint16_t y0, uint16_t r, uint16_t xs, uint16_t ys, uint16_t color);
+  void writeColor(uint16_t color, uint32_t n);
+  boolean drawIndexedBMP(uint16_t x, uint16_t y, TFTLCD_Image *img, 
+			 uint16_t colors, uint32_t skip, uint8_t *buf, TFTLCD_ReadFunc read);
+  boolean drawImage(uint16_t x, uint16_t y, TFTLCD_Image *img, 
+		    uint8_t *buf, TFTLCD_ReadFunc read);
+
+  void startData(void);
+  void endData(void);
 
   void write8(uint8_t d);
   uint8_t read8(void);
@@ -132,6 +172,6 @@ class TFTLCD : public Print {
   uint16_t _width, _height;
   uint8_t textsize;
   uint16_t cursor_x, cursor_y;
-  uint16_t textcolor;
+  uint16_t textcolor, textbgcolor;
   uint8_t rotation;
 };
@@ -0,0 +1,79 @@
+// Scrolls a log of text lines up the screen using the LCD's
+// hardware scroll, so each new line only draws itself instead
+// of redrawing the whole screen.
+
+// The control pins can connect to any pins but we'll use the 
+// analog lines since that means we can double up the pins
+// with the touch screen (see the TFT paint example)
+#define LCD_CS A3    // Chip Select goes to Analog 3
+#define LCD_CD A2    // Command/Data goes to Analog 2
+#define LCD_WR A1    // LCD Write goes to Analog 1
+#define LCD_RD A0    // LCD Read goes to Analog 0
+
+// you can also just connect RESET to the arduino RESET pin
+#define LCD_RESET A4
+
+// Color definitions
+#define	BLACK           0x0000
+#define	GREEN           0x07E0
+#define YELLOW          0xFFE0 
+#define WHITE           0xFFFF
+
+#include "TFTLCD.h"
+
+TFTLCD tft(LCD_CS, LCD_CD, LCD_WR, LCD_RD, LCD_RESET);
+
+#define LINE_HEIGHT 8   // must divide the 320 pixel screen height
+
+uint16_t logy = 0;      // where the next line is drawn
+boolean logfull = false;
+
+void setup(void) {
+  Serial.begin(9600);
+  Serial.println("8 Bit LCD scroll test!");
+  
+  tft.reset();
+  
+  uint16_t identifier = tft.readRegister(0x0);
+  if (identifier == 0x9325) {
+    Serial.println("Found ILI9325");
+  } else if (identifier == 0x9328) {
+    Serial.println("Found ILI9328");
+  } else {
+    Serial.print("Unknown driver chip ");
+    Serial.println(identifier, HEX);
+    while (1);
+  }  
+ 
+  tft.initDisplay();
+  tft.fillScreen(BLACK);
+  tft.scrollTo(0);
+}
+
+void loop(void) {
+  char line[41];
+  uint32_t time = micros();
+
+  sprintf(line, "%lu ms, analog 0 is %d", millis(), analogRead(0));
+  logline(line, logfull ? WHITE : YELLOW);
+  Serial.print(micros() - time, DEC);
+  Serial.println(" us per line");
+  delay(100);
+}
+
+// draw a line of text at the bottom of the log
+void logline(char *s, uint16_t color) {
+  uint16_t w = strlen(s) * 6;
+
+  // once the screen is full the new line goes over the oldest one,
+  // which is at the top, then the screen scrolls to put it at the bottom
+  tft.drawString(0, logy, s, color, BLACK, 1);
+  if (w < tft.width())
+    tft.fillRect(w, logy, tft.width() - w, LINE_HEIGHT, BLACK);
+
+  logy = (logy + LINE_HEIGHT) % tft.height();
+  if (logy == 0)
+    logfull = true;
+  if (logfull)
+    tft.scrollTo(logy);
+}
@@ -0,0 +1,33 @@
+/* ArduinoIcon64x64Rle.h run length encoded copy of ArduinoIcon64x64 for the GLCD library */
+/* Created by glcdRle from bitmaps/ArduinoIcon64x64.h */
+/* 269 bytes, 514 bytes unencoded */
+
+#include <inttypes.h>
+#include <avr/pgmspace.h>
+
+#ifndef ArduinoIcon64x64Rle_H
+#define ArduinoIcon64x64Rle_H
+
+static uint8_t ArduinoIcon64x64Rle[] PROGMEM = {
+  64, // width
+  0xc0, // height 64, compressed
+    0x86, 0x00, 0x01, 0x80, 0x40, 0x83, 0x20, 0x01, 0x40, 0x80, 0x89, 0x00, 0x00, 0xc0, 0x81, 0xe0,
+    0x00, 0xc0, 0x89, 0x00, 0x00, 0x80, 0x97, 0x00, 0x0c, 0x1c, 0x63, 0x80, 0x00, 0x00, 0x7f, 0x3e,
+    0x1c, 0x08, 0x00, 0x80, 0x63, 0x1c, 0x84, 0x00, 0x0a, 0xc0, 0xf8, 0xff, 0xff, 0x7f, 0x0f, 0x7f,
+    0xff, 0xff, 0xf8, 0xc0, 0x83, 0x00, 0x06, 0x80, 0x40, 0x20, 0x3f, 0x20, 0x40, 0x80, 0x95, 0x00,
+    0x02, 0xc0, 0x20, 0x11, 0x83, 0x8a, 0x02, 0x11, 0x20, 0xc0, 0x82, 0x00, 0x02, 0x80, 0xf0, 0xfe,
+    0x81, 0xff, 0x00, 0xe3, 0x81, 0xe0, 0x00, 0xe3, 0x81, 0xff, 0x06, 0xfe, 0xf0, 0x80, 0x00, 0x00,
+    0x81, 0x42, 0x81, 0x24, 0x04, 0x42, 0x85, 0x28, 0x20, 0x38, 0x91, 0x00, 0x04, 0x07, 0x18, 0x20,
+    0x40, 0x8f, 0x81, 0x88, 0x0b, 0x8f, 0x40, 0x20, 0x18, 0x07, 0x00, 0x60, 0xfc, 0xff, 0xff, 0x3f,
+    0x07, 0x87, 0x01, 0x0c, 0x07, 0x3f, 0xff, 0xff, 0xfc, 0x60, 0x01, 0x02, 0x04, 0xfc, 0x24, 0x22,
+    0x21, 0x8e, 0x20, 0x83, 0x40, 0x1f, 0x70, 0x0c, 0x30, 0xc0, 0x00, 0xc0, 0x30, 0x0c, 0x30, 0xc0,
+    0x00, 0xc0, 0x30, 0x08, 0x08, 0x88, 0x48, 0x28, 0x28, 0x38, 0x20, 0x20, 0x40, 0x80, 0x40, 0x20,
+    0x10, 0x20, 0x98, 0x18, 0xc0, 0xc0, 0x81, 0x00, 0x05, 0x20, 0x30, 0x50, 0x48, 0x8f, 0x80, 0x99,
+    0x00, 0x00, 0x03, 0x83, 0x00, 0x13, 0x01, 0x00, 0x00, 0x1c, 0x63, 0x80, 0x46, 0x4a, 0x52, 0x62,
+    0x52, 0x4a, 0x46, 0x80, 0x63, 0x1c, 0x02, 0x01, 0x00, 0x01, 0x83, 0x00, 0x80, 0x08, 0x80, 0x14,
+    0x80, 0xa2, 0x80, 0x41, 0xa3, 0x00, 0x06, 0x01, 0x02, 0x02, 0xfe, 0x02, 0x02, 0x01, 0x8a, 0x00,
+    0x80, 0x02, 0x01, 0x05, 0xfd, 0xa7, 0x00, 0x06, 0x02, 0x0a, 0x0a, 0x2b, 0x0a, 0x0a, 0x02, 0x8a,
+    0x00, 0x80, 0x02, 0x04, 0x0a, 0x2b, 0x0a, 0x02, 0x02, 0x8f, 0x00,
+};
+
+#endif
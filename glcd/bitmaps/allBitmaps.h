@@ -7,4 +7,5 @@
 #include "ArduinoIcon32x32.h"
 #include "ArduinoIcon64x32.h"
 #include "ArduinoIcon64x64.h"
+#include "ArduinoIcon64x64Rle.h"
 #include "ArduinoIcon96x32.h"
@@ -40,6 +40,7 @@ PFont aFont;
 int imgWidth;
 int imgHeight;  
 int imgPages;
+boolean compress = false; // run length encode the image data, see include/glcd_rle.h in the glcd library
 
 public void setup() 
 {
@@ -60,6 +61,14 @@ public void draw()
 {
 }
 
+public void keyPressed() {
+  if(key == 'c' || key == 'C') {
+    compress = !compress;
+    println("Compression " + (compress ? "on" : "off"));
+    clearWindow();
+  }
+}
+
 public void mousePressed() {  
   listImageHeaderFiles( destinationOffset, aggregateHeader );
 }
@@ -69,6 +78,7 @@ public void clearWindow()
   fill(255);
   rect(0,0, width, height);
   fill(0); // font in black
+  text("Type c to turn compression " + (compress ? "off" : "on"), 10 ,height - 70);
   text("Drop image file (gif, jpg, bmp, tga, png) here", 10 ,height - 50);
   text("Click window to refresh " + aggregateHeader, 20 ,height - 30);
   bitmap = null;  
@@ -144,6 +154,17 @@ public void writeFile(String inFileName, String baseName)
   output.print(imgWidth);   // note width and height are bytes so 256 will be 0
   output.println(", // width"); 
   output.print("  ");
+  if(compress) {
+    output.print(imgHeight | 0x80);
+    output.println(", // height, 0x80 flags compressed data"); 
+    stroke(0);
+    writeCompressed(output);
+    output.print("\n};\n");
+    output.println("#endif");
+    output.flush();
+    output.close();
+    return;
+  }
   output.print(imgHeight);
   output.println(", // height"); 
   stroke(0);
@@ -168,6 +189,55 @@ public void writeFile(String inFileName, String baseName)
 
 }
 
+// write the image data as runs of repeated bytes and blocks of literal bytes
+// A control byte below 0x80 is followed by that many plus one literal bytes,
+// a control byte of 0x80 or more is followed by a byte repeated control - 0x80 + 2 times
+public void writeCompressed(PrintWriter output)
+{
+  int[] data = new int[imgWidth * imgPages];
+  for(int page=0; page < imgPages; page++)
+    for(int x=0; x < imgWidth; x++)
+      data[page * imgWidth + x] = getValue(x,page);
+
+  int count = 0;
+  int i = 0;
+  output.print("  ");
+  while(i < data.length) {
+    int n = runLength(data, i);
+    if(n >= 2) {
+      count = writeByte(output, 0x80 + n - 2, count);
+      count = writeByte(output, data[i], count);
+      i += n;
+    }
+    else {
+      // literals up to the next run that saves space
+      int start = i;
+      while(i < data.length && i - start < 128 && runLength(data, i) < 3)
+        i++;
+      count = writeByte(output, i - start - 1, count);
+      for(int j = start; j < i; j++)
+        count = writeByte(output, data[j], count);
+    }
+  }
+  print("Compressed bytes = ");
+  println(count);
+}
+
+// return the number of times data[i] repeats, up to the longest run
+public int runLength(int[] data, int i) {
+  int n = 1;
+  while(i + n < data.length && data[i + n] == data[i] && n < 129)
+    n++;
+  return n;
+}
+
+public int writeByte(PrintWriter output, int val, int count) {
+  output.print("0x" + Integer.toHexString(val) + ",");
+  if(count % 16 == 15)
+    output.print("\n  ");
+  return count + 1;
+}
+
 // return the byte representing data a the given page and x offset
 public int getValue( int x, int page){  
   //print("page= ");println(page);
@@ -0,0 +1,83 @@
+/*
+ * sim_Panel.h - Configuration for a simulated glcd panel
+ *
+ * Use this file to run the library off target (for example on a Linux PC)
+ * with an in memory model of a ks0108 panel.
+ * The model decodes the same commands, strobes and status reads as a real
+ * ks0108 and counts every bus operation so drawing code can be
+ * regression tested pixel for pixel and benchmarked.
+ *
+ * glcd_Config.h selects this file when GLCD_SIM is defined.
+ * The utils/host folder has stand-ins for the Arduino core headers
+ * that define it, a host build looks like:
+ *
+ *  g++ -Iglcd/utils/host -Iglcd sketch.cpp glcd/glcd.cpp glcd/gText.cpp \
+ *      glcd/glcd_Device.cpp glcd/glcd_Sim.cpp
+ *
+ * See include/glcd_sim.h for the counters and the PBM image dump.
+ *
+*/
+
+#ifndef GLCD_PANEL_CONFIG_H
+#define GLCD_PANEL_CONFIG_H
+
+/*
+ * define name for panel configuration
+ */
+#define glcd_PanelConfigName "sim"
+
+#define GLCD_SIM_DEVICE	// use the in memory panel model instead of avr pins
+
+/*********************************************************/
+/*  Configuration for LCD panel specific configuration   */
+/*********************************************************/
+
+/*
+ * The width can be set on the compiler command line to simulate
+ * 192x64 and 256x64 ks0108 panels.
+ */
+#ifndef DISPLAY_WIDTH
+#define DISPLAY_WIDTH 128
+#endif
+#define DISPLAY_HEIGHT 64
+
+// panel controller chips
+#define CHIP_WIDTH     64  // pixels per chip 
+#define CHIP_HEIGHT    64  // pixels per chip 
+
+/*
+ * the following is the calculation of the number of chips - do not change
+ */
+#define glcd_CHIP_COUNT ((DISPLAY_WIDTH + CHIP_WIDTH - 1)  / CHIP_WIDTH)
+
+/*********************************************************/
+/*  Configuration for assigning LCD bits to pins         */
+/*********************************************************/
+
+/*
+ * define name for pin configuration
+ */
+#define glcd_PinConfigName "sim"
+
+/*
+ * The simulated panel has no processor pins.
+ * These are the ids of the control lines in the panel model.
+ */
+#define glcdDI            1
+#define glcdRW            2
+#define glcdEN            3
+
+/*
+ * Timing is not enforced by the model, the delays are only added up
+ * so benchmarks can report the time a real panel would need.
+ * The values match ks0108_Panel.h
+ */
+#define GLCD_tDDR   320    /* Data Delay time (E high to valid read data)        */
+#define GLCD_tAS    140    /* Address setup time (ctrl line changes to E HIGH   */
+#define GLCD_tDSW   200    /* Data setup time (data lines setup to dropping E)   */
+#define GLCD_tWH    450    /* E hi level width (minimum E hi pulse width)        */
+#define GLCD_tWL    450    /* E lo level width (minimum E lo pulse width)        */
+
+#include "device/sim_Device.h"
+
+#endif //GLCD_PANEL_CONFIG_H
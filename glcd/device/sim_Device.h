@@ -0,0 +1,79 @@
+/*
+  sim_Device.h - Arduino library support for graphic LCDs 
+
+ vi:ts=4
+
+  Device header for the simulated ks0108 panel in include/glcd_sim.h
+  The commands and chip layout are the same as ks0108_Device.h
+  
+*/
+
+#ifndef GLCD_PANEL_DEVICE_H
+#define GLCD_PANEL_DEVICE_H
+
+/*
+ * define name for Device
+ */
+#define glcd_DeviceName "sim-ks0108"
+
+/*
+ * Sanity check sim config
+ */
+
+#ifndef GLCD_SIM_DEVICE
+#error "sim_Device.h requires GLCD_SIM_DEVICE"
+#endif
+
+#if DISPLAY_WIDTH > 255
+#error "Simulated ks0108 code only suports up to 255 pixels"
+#endif
+
+#ifdef glcd_CHIP0
+#error "Simulated panel does not use chip select pins"
+#endif
+
+
+/*
+ * LCD commands -------------------------------------------------------------
+ */
+
+#define LCD_ON				0x3F
+#define LCD_OFF				0x3E
+#define LCD_SET_ADD			0x40
+#define LCD_DISP_START		0xC0
+#define LCD_SET_PAGE		0xB8
+
+/*
+ * Status register bits/flags -----------------------------------------------
+ */
+
+#define LCD_BUSY_BIT		7
+#define LCD_BUSY_FLAG		0x80 
+
+#define LCD_RESET_BIT		4
+#define LCD_RESET_FLAG		0x10
+
+/*
+ * Define primitives used by glcd_Device.cpp --------------------------------
+ */
+
+#define glcd_DevSelectChip(chip)	glcd_Sim::SelectChip(chip)
+
+/*
+ * Like the ks0108 there is a single EN line so the chip is ignored.
+ */
+#define glcd_DevENstrobeHi(chip) lcdfastWrite(glcdEN, 1)
+#define glcd_DevENstrobeLo(chip) lcdfastWrite(glcdEN, 0)
+
+/*
+ * Convert X & Y coordinates to chip values
+ */
+#if CHIP_HEIGHT < DISPLAY_HEIGHT
+#define glcd_DevXYval2Chip(x,y) ((x/CHIP_WIDTH) + ((y/CHIP_HEIGHT) * (DISPLAY_HEIGHT/CHIP_HEIGHT)))
+#else
+#define glcd_DevXYval2Chip(x,y)		((x/CHIP_WIDTH))	
+#endif
+
+#define glcd_DevXval2ChipCol(x)		((x) % CHIP_WIDTH)
+
+#endif //GLCD_PANEL_DEVICE_H
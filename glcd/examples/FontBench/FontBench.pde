@@ -0,0 +1,79 @@
+/*
+ * FontBench
+ *
+ * Renders every character of each shipped font and reports
+ * the average number of font data reads and the time per character
+ * on the serial port (9600 baud).
+ *
+ * Run it with and without GLCD_FONT_INDEX defined in glcd_Config.h
+ * to see the cost of locating glyphs in variable width fonts.
+ */
+
+#include <glcd.h>
+#include "fonts/allFonts.h"
+#include "fonts/CalLite24.h"
+#include "fonts/CalBlk36.h"
+
+#define PASSES 3   // number of times each font's characters are drawn
+
+unsigned long fontReads;
+
+// font read callback that counts the reads, same as the default ReadPgmData()
+uint8_t countingRead(const uint8_t* ptr)
+{
+  fontReads++;
+  return pgm_read_byte(ptr);
+}
+
+void benchFont(Font_t font, const char *name)
+{
+  GLCD.ClearScreen();
+  GLCD.SelectFont(font, BLACK, countingRead);
+  GLCD.CursorToXY(0,0);
+
+  uint8_t firstChar = pgm_read_byte(font+FONT_FIRST_CHAR);
+  uint8_t charCount = pgm_read_byte(font+FONT_CHAR_COUNT);
+  unsigned int chars = (unsigned int)PASSES * charCount;
+
+  fontReads = 0;
+  unsigned long startMicros = micros();
+  for(uint8_t pass = 0; pass < PASSES; pass++)
+  {
+    for(uint8_t c = 0; c < charCount; c++)
+      GLCD.PutChar(firstChar + c);
+  }
+  unsigned long usecs = micros() - startMicros;
+
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(fontReads / chars);
+  Serial.print(" reads/char, ");
+  Serial.print(usecs / chars);
+  Serial.println(" us/char");
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  GLCD.Init();
+#ifdef GLCD_FONT_INDEX
+  Serial.println("GLCD_FONT_INDEX enabled");
+#else
+  Serial.println("GLCD_FONT_INDEX disabled");
+#endif
+  benchFont(System5x7, "System5x7");
+  benchFont(Arial_14, "Arial_14");
+  benchFont(Arial_bold_14, "Arial_bold_14");
+  benchFont(Corsiva_12, "Corsiva_12");
+  benchFont(Verdana24, "Verdana24");
+  benchFont(fixednums7x15, "fixednums7x15");
+  benchFont(fixednums8x16, "fixednums8x16");
+  benchFont(fixednums15x31, "fixednums15x31");
+  benchFont(CalLite24, "CalLite24");
+  benchFont(CalBlk36, "CalBlk36");
+  GLCD.SelectFont(System5x7);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,209 @@
+/*
+ * GLCDbench
+ *
+ * Draws each of the library's main primitives a number of times and
+ * reports how fast it runs on the serial port (9600 baud).
+ * Where GLCDdiags checks that the panel works, this sketch measures
+ * how quickly it can be drawn so library changes can be compared.
+ *
+ * On an Arduino the time per frame and frames per second are reported.
+ *
+ * The same sketch also runs on your computer with the simulated panel,
+ * see utils/glcdBench. There the time is that of the computer so instead
+ * the glcd bus operations per frame are reported: EN strobes, commands,
+ * data writes, data reads and status reads.
+ * Saving that output before and after a library change and comparing
+ * the two shows exactly which primitives got faster or slower.
+ */
+
+#include <glcd.h>
+#include "fonts/allFonts.h"
+#include "fonts/CalLite24.h"
+#include "fonts/CalBlk36.h"
+#include "fonts/CalBlk36Rle.h"
+#include "bitmaps/ArduinoIcon64x64.h"
+#ifdef GLCD_SIM_DEVICE
+#include "include/glcd_sim.h"
+#endif
+
+#define FRAMES 10   // number of times each primitive is timed
+
+unsigned long startMicros;
+
+void benchStart()
+{
+#ifdef GLCD_SIM_DEVICE
+  glcd_Sim::ClearCounters();
+#endif
+  startMicros = micros();
+}
+
+void benchEnd(const char *name, unsigned int frames)
+{
+  Serial.print(name);
+  Serial.print(": ");
+#ifdef GLCD_SIM_DEVICE
+  const glcd_SimCounters &count = glcd_Sim::Count;
+
+  Serial.print(count.strobes / frames);
+  Serial.print(" strobes, ");
+  Serial.print(count.commands / frames);
+  Serial.print(" cmds, ");
+  Serial.print(count.dataWrites / frames);
+  Serial.print(" writes, ");
+  Serial.print(count.dataReads / frames);
+  Serial.print(" reads, ");
+  Serial.print(count.statusReads / frames);
+  Serial.println(" status per frame");
+#else
+  unsigned long usecs = micros() - startMicros;
+
+  Serial.print(usecs / frames);
+  Serial.print(" us/frame, ");
+  Serial.print(1000000.0 * frames / usecs, 1);
+  Serial.println(" fps");
+#endif
+}
+
+void benchClearScreen()
+{
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+    GLCD.ClearScreen(frame & 1 ? BLACK : WHITE);
+  benchEnd("ClearScreen", FRAMES);
+}
+
+void benchFillRect()
+{
+  GLCD.ClearScreen();
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+    GLCD.FillRect(3, 5, GLCD.Width-7, GLCD.Height-11, frame & 1 ? WHITE : BLACK);
+  benchEnd("FillRect", FRAMES);
+}
+
+// a frame is a fan of lines from the top left corner to the other edges
+void benchDrawLine()
+{
+  GLCD.ClearScreen();
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+  {
+    for(uint8_t x = 0; x < GLCD.Width; x += 8)
+      GLCD.DrawLine(0, 0, x, GLCD.Bottom, frame & 1 ? WHITE : BLACK);
+    for(uint8_t y = 0; y < GLCD.Height; y += 8)
+      GLCD.DrawLine(0, 0, GLCD.Right, y, frame & 1 ? WHITE : BLACK);
+  }
+  benchEnd("DrawLine", FRAMES);
+}
+
+// a frame is a set of concentric circles
+void benchDrawCircle()
+{
+  GLCD.ClearScreen();
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+  {
+    for(uint8_t r = 3; r < GLCD.Height/2; r += 4)
+      GLCD.DrawCircle(GLCD.CenterX, GLCD.CenterY, r, frame & 1 ? WHITE : BLACK);
+  }
+  benchEnd("DrawCircle", FRAMES);
+}
+
+// a frame fills the display with lines of text
+void benchPuts(Font_t font, const char *name)
+{
+  char line[DISPLAY_WIDTH/2 + 1]; // every character is at least 2 pixels wide with its pad
+  uint8_t firstChar = pgm_read_byte(font+FONT_FIRST_CHAR);
+  uint8_t charCount = pgm_read_byte(font+FONT_CHAR_COUNT);
+  uint8_t height = pgm_read_byte(font+FONT_HEIGHT);
+  uint8_t len = 0;
+
+  GLCD.ClearScreen();
+  GLCD.SelectFont(font);
+
+  // as many of the font's characters as fit on a line
+  line[0] = 0;
+  while(len < sizeof(line) - 1)
+  {
+    line[len] = firstChar + len % charCount;
+    line[len+1] = 0;
+    if(GLCD.StringWidth(line) > GLCD.Width)
+    {
+      line[len] = 0;
+      break;
+    }
+    len++;
+  }
+
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+  {
+    for(uint8_t y = 0; y + height <= GLCD.Height; y += height + 1)
+    {
+      GLCD.CursorToXY(0, y);
+      GLCD.Puts(line);
+    }
+  }
+  benchEnd(name, FRAMES);
+}
+
+// a frame is one new line of text scrolled up from the bottom of the display
+void benchScrollUp()
+{
+  GLCD.ClearScreen();
+  GLCD.SelectFont(System5x7);
+  GLCD.CursorTo(0, GLCD.Height/8 - 1);
+  GLCD.print("scroll");
+
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+    GLCD.print("\nscroll");
+  benchEnd("ScrollUp", FRAMES);
+}
+
+void benchDrawBitmap(uint8_t y, const char *name)
+{
+  GLCD.ClearScreen();
+  benchStart();
+  for(uint8_t frame = 0; frame < FRAMES; frame++)
+    GLCD.DrawBitmap(ArduinoIcon64x64, frame & 1 ? GLCD.Width - 64 : 0, y);
+  benchEnd(name, FRAMES);
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  GLCD.Init();
+
+  Serial.print("Panel: ");
+  Serial.print(glcd_PanelConfigName);
+  Serial.print(" ");
+  Serial.print(DISPLAY_WIDTH);
+  Serial.print("x");
+  Serial.println(DISPLAY_HEIGHT);
+
+  benchClearScreen();
+  benchFillRect();
+  benchDrawLine();
+  benchDrawCircle();
+  benchPuts(System5x7, "Puts System5x7");
+  benchPuts(Arial_14, "Puts Arial_14");
+  benchPuts(Arial_bold_14, "Puts Arial_bold_14");
+  benchPuts(Corsiva_12, "Puts Corsiva_12");
+  benchPuts(Verdana24, "Puts Verdana24");
+  benchPuts(fixednums7x15, "Puts fixednums7x15");
+  benchPuts(fixednums8x16, "Puts fixednums8x16");
+  benchPuts(fixednums15x31, "Puts fixednums15x31");
+  benchPuts(CalLite24, "Puts CalLite24");
+  benchPuts(CalBlk36, "Puts CalBlk36");
+  benchPuts(CalBlk36Rle, "Puts CalBlk36Rle");
+  benchScrollUp();
+  benchDrawBitmap(0, "DrawBitmap");
+  benchDrawBitmap(3, "DrawBitmap unaligned");
+  GLCD.SelectFont(System5x7);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,68 @@
+/*
+ * RleBench
+ *
+ * Compares drawing run length encoded bitmaps and fonts with
+ * drawing the same images and fonts unencoded.
+ * The flash used by each and the average time to draw it
+ * are reported on the serial port (9600 baud).
+ *
+ * The encoded copies were made with utils/glcdRle.
+ */
+
+#include <glcd.h>
+#include "fonts/CalBlk36.h"
+#include "fonts/CalBlk36Rle.h"
+#include "bitmaps/ArduinoIcon64x64.h"
+#include "bitmaps/ArduinoIcon64x64Rle.h"
+
+#define PASSES 10   // number of times each image is drawn
+
+void report(const char *name, unsigned int bytes, unsigned long usecs, unsigned int count)
+{
+  Serial.print(name);
+  Serial.print(": ");
+  Serial.print(bytes);
+  Serial.print(" bytes, ");
+  Serial.print(usecs / count);
+  Serial.println(" us");
+}
+
+void benchBitmap(Image_t bitmap, unsigned int bytes, const char *name)
+{
+  GLCD.ClearScreen();
+  unsigned long startMicros = micros();
+  for(uint8_t pass = 0; pass < PASSES; pass++)
+    GLCD.DrawBitmap(bitmap, 32, 0);
+  report(name, bytes, micros() - startMicros, PASSES);
+}
+
+void benchFont(Font_t font, unsigned int bytes, const char *name)
+{
+  GLCD.ClearScreen();
+  GLCD.SelectFont(font);
+
+  uint8_t firstChar = pgm_read_byte(font+FONT_FIRST_CHAR);
+  uint8_t charCount = pgm_read_byte(font+FONT_CHAR_COUNT);
+
+  unsigned long startMicros = micros();
+  for(uint8_t c = 0; c < charCount; c++)
+  {
+    GLCD.CursorToXY(0,0);
+    GLCD.PutChar(firstChar + c);
+  }
+  report(name, bytes, micros() - startMicros, charCount);
+}
+
+void setup()
+{
+  Serial.begin(9600);
+  GLCD.Init();
+  benchBitmap(ArduinoIcon64x64, sizeof(ArduinoIcon64x64), "ArduinoIcon64x64");
+  benchBitmap(ArduinoIcon64x64Rle, sizeof(ArduinoIcon64x64Rle), "ArduinoIcon64x64Rle");
+  benchFont(CalBlk36, sizeof(CalBlk36), "CalBlk36");
+  benchFont(CalBlk36Rle, sizeof(CalBlk36Rle), "CalBlk36Rle");
+}
+
+void loop()
+{
+}
@@ -348,7 +348,13 @@ void drawFrame(){
     drawRock(i);
   }
   if(playerY != playerYOld){
-    GLCD.FillRect(playerXOld, playerYOld, 10, 8, WHITE);
+    // the bitmap is opaque so only the rows it moved off need clearing
+    if(playerY > playerYOld && playerY < playerYOld + 8)
+      GLCD.FillRect(playerXOld, playerYOld, 9, playerY - playerYOld - 1, WHITE);
+    else if(playerY < playerYOld && playerY + 8 > playerYOld)
+      GLCD.FillRect(playerXOld, playerY + 8, 9, playerYOld - playerY - 1, WHITE);
+    else
+      GLCD.FillRect(playerXOld, playerYOld, 9, 7, WHITE);
     GLCD.DrawBitmap(player, playerX, playerY, BLACK);
   }
 
@@ -371,7 +377,11 @@ void drawRock(char entity){
   
   if(tracker[entity][1] != trackerOld[entity][1]){
 
-    GLCD.FillRect(trackerOld[entity][1], trackerOld[entity][2], 12, 8, WHITE);
+    if(tracker[entity][1] < trackerOld[entity][1] && tracker[entity][2] == trackerOld[entity][2])
+      // the rock moved left, the bitmap covers all but the columns it moved off
+      GLCD.FillRect(tracker[entity][1]+8, trackerOld[entity][2], trackerOld[entity][1] - tracker[entity][1] - 1, 7, WHITE);
+    else
+      GLCD.FillRect(trackerOld[entity][1], trackerOld[entity][2], 7, 7, WHITE);
     GLCD.DrawBitmap(rocks[tracker[entity][0]], tracker[entity][1], tracker[entity][2], BLACK);
   }
 }
@@ -127,6 +127,7 @@ byte generations[STABLE_GENERATIONS][ROWS][BYTES_PER_COLUMN]; // array used to c
 void setup(){     
   GLCD.Init();   // initialise the library, non inverted writes pixels onto a clear screen
   GLCD.SelectFont(System5x7);
+  GLCD.SetUpdateMode(UPDATE_DEFERRED); // draw each generation in RAM, needs GLCD_SHADOW_BUFFER in glcd_Config.h
   seed(0);
 }
 
@@ -136,6 +137,7 @@ void loop (void){
   GLCD.CursorTo(0,0); 
   GLCD.print(i);
   GLCD.print(" iterations");  
+  GLCD.Update();
   delay(1500);   
   seed(1); // use random seed
 }   
@@ -155,6 +157,7 @@ unsigned int generate(){
            GLCD.DrawRoundRect(column * CELL_SIZE, row * CELL_SIZE,  CELL_SIZE-1, CELL_SIZE-1, CELL_SIZE/2, WHITE) ; 
       }
   }
+  GLCD.Update();
 
   delay(1500); // show the seeded condition a little longer 
   do{    
@@ -185,6 +188,7 @@ unsigned int generate(){
         }
       }
     } 
+    GLCD.Update();  // show the new generation
   }
   while(isStable(thisGeneration) == false  && ++iteration < MAX_ITERATIONS ) ;
   return iteration;
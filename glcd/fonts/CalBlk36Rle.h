@@ -0,0 +1,539 @@
+/* CalBlk36Rle.h run length encoded copy of CalBlk36 for the GLCD library */
+/* Created by glcdRle from fonts/CalBlk36.h */
+/* 4391 bytes, 9197 bytes unencoded */
+
+#include <inttypes.h>
+#include <avr/pgmspace.h>
+
+#ifndef CalBlk36Rle_H
+#define CalBlk36Rle_H
+
+static uint8_t CalBlk36Rle[] PROGMEM = {
+    0xff, 0xff, // size of 0xffff indicates compressed font
+    10, // width
+    36, // height
+    32, // first char
+    96, // char count
+
+    // char widths
+    0x00, 0x08, 0x10, 0x16, 0x16, 0x20, 0x1b, 0x08, 0x0a, 0x0a, 0x0e, 0x13, 0x08, 0x0a, 0x08, 0x0a,
+    0x15, 0x0f, 0x15, 0x14, 0x16, 0x15, 0x15, 0x14, 0x14, 0x15, 0x08, 0x08, 0x14, 0x13, 0x14, 0x14,
+    0x1b, 0x1c, 0x17, 0x18, 0x17, 0x15, 0x13, 0x1a, 0x18, 0x08, 0x14, 0x1b, 0x14, 0x1d, 0x18, 0x1a,
+    0x15, 0x1b, 0x19, 0x17, 0x18, 0x18, 0x1c, 0x24, 0x1c, 0x1c, 0x18, 0x0b, 0x0a, 0x0b, 0x13, 0x12,
+    0x08, 0x16, 0x15, 0x15, 0x15, 0x16, 0x0e, 0x15, 0x14, 0x08, 0x0a, 0x16, 0x08, 0x20, 0x14, 0x16,
+    0x15, 0x15, 0x0e, 0x14, 0x0e, 0x14, 0x16, 0x22, 0x16, 0x16, 0x12, 0x0e, 0x04, 0x0e, 0x14, 0x00,
+
+    // glyph offsets
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x13, 0x00, 0x28, 0x00, 0x68, 0x00, 0xb9, 0x01, 0x1d, 0x01, 0x70,
+    0x01, 0x7e, 0x01, 0xa8, 0x01, 0xd2, 0x01, 0xee, 0x02, 0x06, 0x02, 0x1b, 0x02, 0x21, 0x02, 0x29,
+    0x02, 0x4c, 0x02, 0x85, 0x02, 0xa2, 0x02, 0xdb, 0x03, 0x18, 0x03, 0x44, 0x03, 0x76, 0x03, 0xb9,
+    0x03, 0xdd, 0x04, 0x1d, 0x04, 0x63, 0x04, 0x6d, 0x04, 0x84, 0x04, 0xb8, 0x04, 0xbe, 0x04, 0xf0,
+    0x05, 0x24, 0x05, 0x90, 0x05, 0xce, 0x05, 0xf9, 0x06, 0x35, 0x06, 0x60, 0x06, 0x72, 0x06, 0x84,
+    0x06, 0xc9, 0x06, 0xe1, 0x06, 0xe9, 0x07, 0x0b, 0x07, 0x4c, 0x07, 0x5c, 0x07, 0x97, 0x07, 0xc6,
+    0x08, 0x0a, 0x08, 0x2d, 0x08, 0x7d, 0x08, 0xba, 0x08, 0xff, 0x09, 0x11, 0x09, 0x3a, 0x09, 0x7e,
+    0x09, 0xd0, 0x0a, 0x27, 0x0a, 0x60, 0x0a, 0x8c, 0x0a, 0x9c, 0x0a, 0xbd, 0x0a, 0xcd, 0x0a, 0xef,
+    0x0a, 0xf5, 0x0b, 0x00, 0x0b, 0x38, 0x0b, 0x68, 0x0b, 0x9c, 0x0b, 0xce, 0x0c, 0x01, 0x0c, 0x1c,
+    0x0c, 0x5f, 0x0c, 0x80, 0x0c, 0x8a, 0x0c, 0xa5, 0x0c, 0xda, 0x0c, 0xe2, 0x0d, 0x14, 0x0d, 0x33,
+    0x0d, 0x6a, 0x0d, 0x9b, 0x0d, 0xcb, 0x0d, 0xe1, 0x0e, 0x16, 0x0e, 0x35, 0x0e, 0x56, 0x0e, 0x8a,
+    0x0e, 0xd4, 0x0f, 0x13, 0x0f, 0x58, 0x0f, 0x78, 0x0f, 0xa9, 0x0f, 0xaf, 0x0f, 0xe0, 0x10, 0x01,
+
+    // char 32
+
+    // char 33
+    0x86, 0xfc, 0x00, 0x07, 0x84, 0xff, 0x02, 0x07, 0xc0, 0xc7, 0x82, 0xcf, 0x01, 0xc7, 0xc0, 0x86,
+    0x0f, 0x86, 0x00,
+
+    // char 34
+    0x85, 0xfc, 0x80, 0x00, 0x85, 0xfc, 0x00, 0x01, 0x83, 0x0f, 0x03, 0x01, 0x00, 0x00, 0x01, 0x83,
+    0x0f, 0x00, 0x01, 0xae, 0x00,
+
+    // char 35
+    0x83, 0x00, 0x00, 0x80, 0x82, 0xfc, 0x00, 0x7c, 0x81, 0x00, 0x00, 0xc0, 0x82, 0xfc, 0x02, 0x3c,
+    0x00, 0x00, 0x82, 0x1f, 0x83, 0xff, 0x82, 0x1f, 0x83, 0xff, 0x82, 0x1f, 0x80, 0x3e, 0x80, 0xfe,
+    0x81, 0xff, 0x04, 0x7f, 0x3f, 0x3e, 0x3e, 0xfe, 0x82, 0xff, 0x00, 0x3f, 0x82, 0x3e, 0x02, 0x3c,
+    0x00, 0x08, 0x82, 0x0f, 0x00, 0x07, 0x81, 0x00, 0x00, 0x0c, 0x82, 0x0f, 0x00, 0x03, 0x9a, 0x00,
+
+    // char 36
+    0x0e, 0x00, 0x80, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0x7c, 0x7c, 0xff, 0xff, 0x7c, 0xfc, 0xfc,
+    0x81, 0xf8, 0x07, 0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x0f, 0x3f, 0x7f, 0x82, 0xff, 0x0e, 0xfc, 0xf8,
+    0xff, 0xff, 0xf0, 0xf0, 0xf1, 0xe1, 0xe1, 0xc1, 0xc1, 0x81, 0x00, 0x00, 0x30, 0x84, 0xf0, 0x07,
+    0xe1, 0x81, 0x83, 0xff, 0xff, 0x87, 0x87, 0xcf, 0x84, 0xff, 0x05, 0x3c, 0x00, 0x00, 0x03, 0x03,
+    0x07, 0x81, 0x0f, 0x80, 0x1f, 0x80, 0xff, 0x80, 0x1f, 0x81, 0x0f, 0x02, 0x07, 0x03, 0x01, 0x96,
+    0x00,
+
+    // char 37
+    0x04, 0xc0, 0xf0, 0xf8, 0xfc, 0x7c, 0x81, 0x1c, 0x04, 0x7c, 0xfc, 0xf8, 0xf8, 0xc0, 0x84, 0x00,
+    0x05, 0xc0, 0xf0, 0xfc, 0x7c, 0x1c, 0x04, 0x85, 0x00, 0x04, 0x07, 0x1f, 0x3f, 0x7f, 0x7c, 0x81,
+    0x70, 0x0d, 0x7c, 0x7f, 0x3f, 0x3f, 0x07, 0x00, 0x80, 0xe0, 0xf8, 0xfe, 0x3f, 0x1f, 0x07, 0x01,
+    0x92, 0x00, 0x0d, 0xc0, 0xe0, 0xf8, 0xfe, 0x3f, 0x0f, 0x03, 0x00, 0x00, 0xf0, 0xfe, 0xfe, 0xff,
+    0x1f, 0x81, 0x07, 0x04, 0x1f, 0xff, 0xfe, 0xfc, 0xf0, 0x85, 0x00, 0x05, 0x10, 0x1c, 0x1f, 0x1f,
+    0x07, 0x03, 0x84, 0x00, 0x04, 0x01, 0x0f, 0x0f, 0x1f, 0x1f, 0x81, 0x1c, 0x80, 0x1f, 0x02, 0x0f,
+    0x07, 0x01, 0x9e, 0x00,
+
+    // char 38
+    0x82, 0x00, 0x06, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x7c, 0x81, 0x3c, 0x05, 0x7c, 0xfc, 0xf8,
+    0xf8, 0xf0, 0xe0, 0x88, 0x00, 0x02, 0x80, 0xc7, 0xdf, 0x82, 0xff, 0x00, 0xfe, 0x81, 0xfc, 0x05,
+    0xfe, 0xbf, 0x1f, 0x1f, 0x0f, 0x03, 0x85, 0x00, 0x01, 0xfc, 0xfe, 0x83, 0xff, 0x07, 0xc7, 0x83,
+    0x03, 0x03, 0x07, 0x0f, 0x9f, 0xbf, 0x81, 0xff, 0x80, 0xfe, 0x82, 0xff, 0x07, 0xcf, 0x80, 0x00,
+    0x00, 0x01, 0x03, 0x07, 0x07, 0x89, 0x0f, 0x80, 0x07, 0x81, 0x03, 0x04, 0x07, 0x0f, 0x0f, 0x07,
+    0x03, 0x9a, 0x00,
+
+    // char 39
+    0x00, 0x38, 0x84, 0xfc, 0x02, 0x78, 0x00, 0x07, 0x82, 0x0f, 0x00, 0x07, 0x97, 0x00,
+
+    // char 40
+    0x81, 0x00, 0x08, 0xc0, 0xf0, 0xf8, 0xfc, 0xfc, 0x7c, 0x1c, 0xc0, 0xfc, 0x83, 0xff, 0x02, 0x03,
+    0x00, 0x00, 0x84, 0xff, 0x00, 0xf1, 0x82, 0x00, 0x02, 0x07, 0x1f, 0x7f, 0x81, 0xff, 0x01, 0xf8,
+    0x80, 0x83, 0x00, 0x01, 0x01, 0x07, 0x81, 0x0f, 0x00, 0x0e,
+
+    // char 41
+    0x06, 0x0c, 0x7c, 0xfc, 0xfc, 0xf8, 0xf0, 0xc0, 0x83, 0x00, 0x00, 0x03, 0x83, 0xff, 0x01, 0xfc,
+    0xc0, 0x81, 0x00, 0x00, 0xf1, 0x84, 0xff, 0x02, 0x00, 0x80, 0xf8, 0x81, 0xff, 0x04, 0x7f, 0x1f,
+    0x07, 0x00, 0x0e, 0x81, 0x0f, 0x01, 0x07, 0x01, 0x82, 0x00,
+
+    // char 42
+    0x00, 0x00, 0x81, 0xe0, 0x05, 0xc0, 0xdc, 0xfc, 0xfc, 0xdc, 0xc0, 0x81, 0xe0, 0x81, 0x00, 0x09,
+    0x19, 0x3d, 0x3f, 0x1f, 0x07, 0x0f, 0x3f, 0x3d, 0x3d, 0x19, 0xaa, 0x00,
+
+    // char 43
+    0x85, 0x00, 0x84, 0xc0, 0x84, 0x00, 0x85, 0xf0, 0x84, 0xff, 0x84, 0xf0, 0x85, 0x03, 0x84, 0xff,
+    0x84, 0x03, 0x85, 0x00, 0x84, 0x01, 0x97, 0x00,
+
+    // char 44
+    0x8e, 0x00, 0x86, 0xe0, 0x03, 0x0f, 0x8f, 0x8f, 0xef, 0x81, 0xff, 0x08, 0x1f, 0x03, 0x07, 0x07,
+    0x03, 0x03, 0x01, 0x00, 0x00,
+
+    // char 45
+    0x92, 0x00, 0x88, 0x1f, 0x92, 0x00,
+
+    // char 46
+    0x8e, 0x00, 0x86, 0xe0, 0x86, 0x0f, 0x86, 0x00,
+
+    // char 47
+    0x83, 0x00, 0x00, 0xc0, 0x81, 0xfc, 0x00, 0x0c, 0x81, 0x00, 0x04, 0xc0, 0xfc, 0xff, 0xff, 0x1f,
+    0x81, 0x00, 0x05, 0xc0, 0xfc, 0xff, 0xff, 0x1f, 0x01, 0x81, 0x00, 0x00, 0x0c, 0x81, 0x0f, 0x00,
+    0x01, 0x8d, 0x00,
+
+    // char 48
+    0x07, 0x00, 0xc0, 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x82, 0x7c, 0x80, 0xfc, 0x80, 0xf8, 0x04,
+    0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x85, 0xff, 0x84, 0x00, 0x85, 0xff, 0x01, 0x00, 0x3f, 0x84, 0xff,
+    0x00, 0xc0, 0x82, 0x80, 0x00, 0xc0, 0x84, 0xff, 0x00, 0x3f, 0x81, 0x00, 0x02, 0x03, 0x07, 0x07,
+    0x88, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01, 0x95, 0x00,
+
+    // char 49
+    0x81, 0x00, 0x80, 0x80, 0x02, 0xc0, 0xe0, 0xf0, 0x85, 0xfc, 0x81, 0x3f, 0x80, 0x1f, 0x01, 0x0f,
+    0x07, 0x86, 0xff, 0x85, 0x00, 0x86, 0xff, 0x85, 0x00, 0x86, 0x0f, 0x8d, 0x00,
+
+    // char 50
+    0x05, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0x81, 0xfc, 0x82, 0x7c, 0x81, 0xfc, 0x80, 0xf8, 0x03,
+    0xf0, 0xe0, 0xc0, 0x00, 0x85, 0x03, 0x05, 0x00, 0x80, 0xc0, 0xc0, 0xe0, 0xf8, 0x82, 0xff, 0x09,
+    0x7f, 0x3f, 0x0f, 0x00, 0x80, 0xc0, 0xf0, 0xf8, 0xfc, 0xfe, 0x82, 0xff, 0x05, 0xdf, 0xcf, 0xc7,
+    0xc7, 0xc3, 0xc1, 0x82, 0xc0, 0x93, 0x0f, 0x93, 0x00,
+
+    // char 51
+    0x0b, 0x80, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x7c, 0x7c, 0x3c, 0x7c, 0x7c, 0x81, 0xfc, 0x80,
+    0xf8, 0x02, 0xf0, 0xc0, 0x00, 0x85, 0x01, 0x04, 0x00, 0xf0, 0xf0, 0xf8, 0xf8, 0x82, 0xff, 0x03,
+    0xdf, 0x8f, 0x87, 0x00, 0x85, 0xe0, 0x00, 0x80, 0x82, 0x01, 0x00, 0x83, 0x85, 0xff, 0x04, 0x00,
+    0x01, 0x03, 0x07, 0x07, 0x88, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01, 0x93, 0x00,
+
+    // char 52
+    0x86, 0x00, 0x03, 0x80, 0xc0, 0xe0, 0xf8, 0x85, 0xfc, 0x82, 0x00, 0x0b, 0x80, 0xc0, 0xe0, 0xf0,
+    0xfc, 0xfe, 0xff, 0x7f, 0x1f, 0x0f, 0x07, 0x03, 0x84, 0xff, 0x81, 0x00, 0x84, 0x7f, 0x00, 0x7d,
+    0x84, 0x7c, 0x84, 0xff, 0x81, 0x7c, 0x8b, 0x00, 0x84, 0x0f, 0x97, 0x00,
+
+    // char 53
+    0x80, 0x00, 0x8f, 0xfc, 0x82, 0x00, 0x83, 0xff, 0x00, 0xf8, 0x82, 0x78, 0x82, 0xf8, 0x07, 0xf0,
+    0xe0, 0xe0, 0x80, 0x00, 0x00, 0xe0, 0xe0, 0x82, 0xe1, 0x00, 0x80, 0x82, 0x00, 0x00, 0x80, 0x84,
+    0xff, 0x06, 0x7f, 0x1e, 0x00, 0x01, 0x03, 0x07, 0x07, 0x88, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01,
+    0x95, 0x00,
+
+    // char 54
+    0x08, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x7c, 0x81, 0x3c, 0x09, 0x7c, 0xfc, 0xfc,
+    0xf8, 0xf8, 0xf0, 0xe0, 0x00, 0x00, 0xfe, 0x84, 0xff, 0x01, 0xe1, 0xf0, 0x81, 0x78, 0x82, 0xf8,
+    0x05, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x3f, 0x84, 0xff, 0x01, 0xc1, 0x80, 0x81, 0x00, 0x01, 0x80,
+    0xc1, 0x84, 0xff, 0x06, 0x3e, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x88, 0x0f, 0x02, 0x07, 0x03,
+    0x03, 0x95, 0x00,
+
+    // char 55
+    0x92, 0xfc, 0x86, 0x00, 0x0a, 0xc0, 0xf0, 0xf8, 0xfe, 0xff, 0xff, 0x7f, 0x1f, 0x0f, 0x03, 0x01,
+    0x84, 0x00, 0x01, 0xe0, 0xfc, 0x83, 0xff, 0x01, 0x0f, 0x01, 0x88, 0x00, 0x00, 0x0e, 0x84, 0x0f,
+    0x00, 0x01, 0x9a, 0x00,
+
+    // char 56
+    0x07, 0x80, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x7c, 0x81, 0x3c, 0x00, 0x7c, 0x81, 0xfc, 0x80,
+    0xf8, 0x05, 0xf0, 0xe0, 0x80, 0x03, 0x0f, 0x9f, 0x82, 0xff, 0x00, 0xf8, 0x82, 0xf0, 0x00, 0xfc,
+    0x82, 0xff, 0x03, 0x9f, 0x0f, 0x03, 0xfe, 0x84, 0xff, 0x05, 0x83, 0x01, 0x00, 0x00, 0x01, 0x83,
+    0x84, 0xff, 0x04, 0xfe, 0x00, 0x03, 0x07, 0x07, 0x89, 0x0f, 0x81, 0x07, 0x00, 0x01, 0x93, 0x00,
+
+    // char 57
+    0x16, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x7c, 0x3c, 0x3c, 0x7c, 0x7c, 0xfc, 0xfc,
+    0xf8, 0xf8, 0xf0, 0xe0, 0xc0, 0x00, 0x3f, 0x7f, 0x83, 0xff, 0x01, 0xe0, 0xc0, 0x81, 0x80, 0x01,
+    0xc0, 0xe0, 0x84, 0xff, 0x05, 0xfe, 0x00, 0xc0, 0xc1, 0xc3, 0xc3, 0x81, 0xc7, 0x00, 0x87, 0x81,
+    0x07, 0x01, 0x83, 0xe1, 0x84, 0xff, 0x05, 0x3f, 0x00, 0x00, 0x01, 0x03, 0x07, 0x88, 0x0f, 0x80,
+    0x07, 0x01, 0x03, 0x01, 0x95, 0x00,
+
+    // char 58
+    0x86, 0x00, 0x86, 0xfe, 0x86, 0xe0, 0x86, 0x0f, 0x86, 0x00,
+
+    // char 59
+    0x86, 0x00, 0x86, 0xfe, 0x86, 0xe0, 0x03, 0x0f, 0x8f, 0x8f, 0xef, 0x81, 0xff, 0x08, 0x1f, 0x01,
+    0x07, 0x07, 0x03, 0x03, 0x01, 0x00, 0x00,
+
+    // char 60
+    0x8a, 0x00, 0x80, 0x80, 0x81, 0xc0, 0x80, 0xe0, 0x81, 0xf0, 0x81, 0xf8, 0x80, 0xfc, 0x80, 0xfe,
+    0x02, 0x3e, 0x3f, 0x3f, 0x81, 0x1f, 0x80, 0x0f, 0x81, 0x07, 0x80, 0x03, 0x80, 0x07, 0x81, 0x0f,
+    0x80, 0x1f, 0x80, 0x3f, 0x81, 0x7e, 0x80, 0xfc, 0x81, 0xf8, 0x00, 0xf0, 0x8e, 0x00, 0x81, 0x01,
+    0x00, 0x03, 0x92, 0x00,
+
+    // char 61
+    0x91, 0x00, 0xa4, 0x3e, 0xa4, 0x00,
+
+    // char 62
+    0x04, 0xf0, 0xe0, 0xe0, 0xc0, 0xc0, 0x81, 0x80, 0x8a, 0x00, 0x81, 0x07, 0x80, 0x0f, 0x81, 0x1f,
+    0x80, 0x3f, 0x06, 0x7e, 0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf8, 0x82, 0xf0, 0x80, 0xf8, 0x81, 0xfc,
+    0x80, 0x7e, 0x04, 0x3e, 0x3f, 0x3f, 0x1f, 0x1f, 0x81, 0x0f, 0x80, 0x07, 0x81, 0x03, 0x81, 0x01,
+    0xa2, 0x00,
+
+    // char 63
+    0x05, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xf8, 0x81, 0xfc, 0x80, 0x7c, 0x81, 0xfc, 0x81, 0xf8, 0x05,
+    0xf0, 0xe0, 0x80, 0x00, 0x03, 0x03, 0x82, 0x07, 0x04, 0x81, 0xc0, 0xe0, 0xf0, 0xf8, 0x81, 0xff,
+    0x80, 0x7f, 0x02, 0x3f, 0x1f, 0x0f, 0x84, 0x00, 0x00, 0xce, 0x84, 0xcf, 0x00, 0x01, 0x8a, 0x00,
+    0x85, 0x0f, 0x99, 0x00,
+
+    // char 64
+    0x81, 0x00, 0x0b, 0x80, 0xc0, 0xe0, 0x70, 0x78, 0x38, 0x18, 0x1c, 0x9c, 0x9c, 0x8c, 0x0c, 0x82,
+    0x1c, 0x28, 0x38, 0x78, 0x70, 0xe0, 0xc0, 0x80, 0x00, 0x00, 0xe0, 0xfc, 0xff, 0x0f, 0x03, 0xc0,
+    0xf0, 0xfc, 0xfe, 0x3f, 0x0f, 0x07, 0x03, 0x03, 0x07, 0xde, 0xfe, 0xff, 0xff, 0x1f, 0x00, 0x00,
+    0x01, 0x07, 0xff, 0xfe, 0xf0, 0x3f, 0xff, 0xff, 0xc0, 0x00, 0x3f, 0x81, 0xff, 0x00, 0xc0, 0x81,
+    0x80, 0x01, 0xc0, 0xf0, 0x81, 0xff, 0x07, 0x87, 0x80, 0xc0, 0xe0, 0xf0, 0x7c, 0x3f, 0x0f, 0x81,
+    0x00, 0x07, 0x03, 0x07, 0x0f, 0x1c, 0x38, 0x71, 0x71, 0x63, 0x81, 0xe3, 0x0c, 0xe1, 0xe0, 0xe1,
+    0xe3, 0xe3, 0x63, 0x73, 0x71, 0x39, 0x38, 0x1c, 0x0c, 0x04, 0x9a, 0x00,
+
+    // char 65
+    0x86, 0x00, 0x01, 0xe0, 0xf8, 0x86, 0xfc, 0x01, 0xf8, 0xe0, 0x8b, 0x00, 0x01, 0xe0, 0xf8, 0x83,
+    0xff, 0x03, 0x3f, 0x03, 0x07, 0x3f, 0x83, 0xff, 0x01, 0xfc, 0xe0, 0x85, 0x00, 0x01, 0xe0, 0xf8,
+    0x85, 0xff, 0x00, 0xfd, 0x82, 0xfc, 0x00, 0xfd, 0x85, 0xff, 0x04, 0xfc, 0xe0, 0x00, 0x00, 0x08,
+    0x85, 0x0f, 0x00, 0x07, 0x88, 0x00, 0x00, 0x07, 0x85, 0x0f, 0x00, 0x0c, 0x9a, 0x00,
+
+    // char 66
+    0x86, 0xfc, 0x82, 0x7c, 0x82, 0xfc, 0x81, 0xf8, 0x80, 0xf0, 0x01, 0xc0, 0x00, 0x86, 0xff, 0x84,
+    0xf0, 0x83, 0xff, 0x03, 0xbf, 0x9f, 0x07, 0x00, 0x86, 0xff, 0x84, 0xc1, 0x00, 0xc3, 0x85, 0xff,
+    0x00, 0xfe, 0x90, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01, 0x96, 0x00,
+
+    // char 67
+    0x04, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0x81, 0xf8, 0x88, 0xfc, 0x80, 0xf8, 0x04, 0xf0, 0xe0, 0xc0,
+    0x80, 0xfc, 0x85, 0xff, 0x01, 0x07, 0x01, 0x83, 0x00, 0x80, 0x01, 0x85, 0x07, 0x01, 0x0f, 0x7f,
+    0x84, 0xff, 0x01, 0xf0, 0xe0, 0x84, 0xc0, 0x00, 0xe0, 0x84, 0xfc, 0x00, 0x7c, 0x81, 0x00, 0x03,
+    0x01, 0x03, 0x07, 0x07, 0x8a, 0x0f, 0x02, 0x07, 0x03, 0x01, 0x98, 0x00,
+
+    // char 68
+    0x8d, 0xfc, 0x81, 0xf8, 0x04, 0xf0, 0xe0, 0xc0, 0x80, 0x00, 0x86, 0xff, 0x82, 0x00, 0x80, 0x01,
+    0x00, 0x03, 0x85, 0xff, 0x00, 0xfe, 0x86, 0xff, 0x82, 0xc0, 0x80, 0xe0, 0x00, 0xf0, 0x84, 0xff,
+    0x01, 0x7f, 0x1f, 0x8d, 0x0f, 0x81, 0x07, 0x80, 0x03, 0x98, 0x00,
+
+    // char 69
+    0x93, 0xfc, 0x86, 0xff, 0x8a, 0xf0, 0x00, 0x00, 0x86, 0xff, 0x8a, 0xc1, 0x00, 0xc0, 0x93, 0x0f,
+    0x93, 0x00,
+
+    // char 70
+    0x91, 0xfc, 0x86, 0xff, 0x88, 0xf0, 0x00, 0x00, 0x86, 0xff, 0x88, 0x01, 0x00, 0x00, 0x86, 0x0f,
+    0x9c, 0x00,
+
+    // char 71
+    0x80, 0x00, 0x05, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0x8a, 0xfc, 0x80, 0xf8, 0x04, 0xf0, 0xe0,
+    0x80, 0x00, 0xfc, 0x85, 0xff, 0x01, 0x07, 0x01, 0x82, 0x00, 0x80, 0xe0, 0x00, 0xe1, 0x86, 0xe3,
+    0x02, 0xe0, 0x0f, 0x7f, 0x84, 0xff, 0x0a, 0xf0, 0xe0, 0xc0, 0xc0, 0x80, 0x80, 0x87, 0x87, 0xc7,
+    0xc7, 0xe7, 0x85, 0xff, 0x81, 0x00, 0x01, 0x01, 0x03, 0x81, 0x07, 0x8a, 0x0f, 0x80, 0x07, 0x80,
+    0x03, 0x80, 0x01, 0x98, 0x00,
+
+    // char 72
+    0x86, 0xfc, 0x86, 0x00, 0x86, 0xfc, 0x86, 0xff, 0x86, 0xf8, 0x8e, 0xff, 0x86, 0x03, 0x86, 0xff,
+    0x86, 0x0f, 0x86, 0x00, 0x86, 0x0f, 0x96, 0x00,
+
+    // char 73
+    0x86, 0xfc, 0x8e, 0xff, 0x86, 0x0f, 0x86, 0x00,
+
+    // char 74
+    0x8a, 0x00, 0x86, 0xfc, 0x8a, 0x00, 0x86, 0xff, 0x00, 0x78, 0x84, 0xf8, 0x00, 0xe0, 0x82, 0xc0,
+    0x85, 0xff, 0x05, 0x7f, 0x00, 0x01, 0x03, 0x07, 0x07, 0x88, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01,
+    0x93, 0x00,
+
+    // char 75
+    0x86, 0xfc, 0x82, 0x00, 0x04, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0x82, 0xfc, 0x05, 0x7c, 0x3c, 0x1c,
+    0x0c, 0x04, 0x00, 0x86, 0xff, 0x02, 0xf8, 0xfc, 0xfe, 0x85, 0xff, 0x01, 0xc3, 0x01, 0x85, 0x00,
+    0x86, 0xff, 0x06, 0x1f, 0x0f, 0x07, 0x03, 0x07, 0x1f, 0x7f, 0x83, 0xff, 0x03, 0xfe, 0xf8, 0xe0,
+    0xc0, 0x81, 0x00, 0x86, 0x0f, 0x85, 0x00, 0x01, 0x01, 0x07, 0x86, 0x0f, 0x01, 0x0c, 0x08, 0x99,
+    0x00,
+
+    // char 76
+    0x86, 0xfc, 0x8a, 0x00, 0x86, 0xff, 0x8a, 0x00, 0x86, 0xff, 0x8a, 0xc0, 0x92, 0x0f, 0x92, 0x00,
+
+    // char 77
+    0x88, 0xfc, 0x00, 0xf0, 0x84, 0x00, 0x00, 0xe0, 0x89, 0xfc, 0x84, 0xff, 0x01, 0x03, 0x3f, 0x82,
+    0xff, 0x03, 0xf0, 0x00, 0x00, 0xf0, 0x82, 0xff, 0x01, 0x3f, 0x03, 0x8b, 0xff, 0x80, 0x00, 0x01,
+    0x03, 0x3f, 0x86, 0xff, 0x03, 0x3f, 0x03, 0x00, 0x00, 0x85, 0xff, 0x84, 0x0f, 0x82, 0x00, 0x00,
+    0x03, 0x84, 0x0f, 0x00, 0x03, 0x82, 0x00, 0x85, 0x0f, 0x9b, 0x00,
+
+    // char 78
+    0x85, 0xfc, 0x03, 0xf8, 0xf0, 0xc0, 0x80, 0x84, 0x00, 0x85, 0xfc, 0x85, 0xff, 0x00, 0x7f, 0x81,
+    0xff, 0x05, 0xfe, 0xfc, 0xf0, 0xe0, 0x80, 0x00, 0x8c, 0xff, 0x80, 0x00, 0x04, 0x01, 0x07, 0x0f,
+    0x3f, 0x7f, 0x88, 0xff, 0x85, 0x0f, 0x85, 0x00, 0x01, 0x01, 0x03, 0x86, 0x0f, 0x96, 0x00,
+
+    // char 79
+    0x07, 0x00, 0x80, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0x88, 0xfc, 0x80, 0xf8, 0x80, 0xf0, 0x04,
+    0xe0, 0xc0, 0x80, 0x00, 0xfc, 0x85, 0xff, 0x01, 0x07, 0x01, 0x84, 0x00, 0x01, 0x01, 0x07, 0x85,
+    0xff, 0x02, 0xfc, 0x0f, 0x7f, 0x84, 0xff, 0x01, 0xf0, 0xe0, 0x84, 0xc0, 0x01, 0xe0, 0xf0, 0x84,
+    0xff, 0x01, 0x7f, 0x0f, 0x81, 0x00, 0x03, 0x01, 0x03, 0x07, 0x07, 0x8a, 0x0f, 0x80, 0x07, 0x01,
+    0x03, 0x01, 0x9b, 0x00,
+
+    // char 80
+    0x86, 0xfc, 0x82, 0x7c, 0x82, 0xfc, 0x80, 0xf8, 0x02, 0xf0, 0xe0, 0xc0, 0x86, 0xff, 0x82, 0xe0,
+    0x01, 0xf0, 0xf9, 0x84, 0xff, 0x00, 0x3f, 0x86, 0xff, 0x87, 0x03, 0x80, 0x01, 0x80, 0x00, 0x86,
+    0x0f, 0xa0, 0x00,
+
+    // char 81
+    0x80, 0x00, 0x05, 0xc0, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0x88, 0xfc, 0x80, 0xf8, 0x80, 0xf0, 0x05,
+    0xe0, 0xc0, 0x80, 0x00, 0x00, 0xfc, 0x85, 0xff, 0x01, 0x07, 0x01, 0x84, 0x00, 0x01, 0x01, 0x07,
+    0x85, 0xff, 0x03, 0xfc, 0x00, 0x1f, 0x7f, 0x84, 0xff, 0x09, 0xf0, 0xe0, 0xc0, 0xc0, 0xcc, 0xdc,
+    0xfc, 0xfc, 0xf8, 0xf0, 0x84, 0xff, 0x01, 0x3f, 0x0f, 0x82, 0x00, 0x05, 0x01, 0x03, 0x03, 0x07,
+    0x0f, 0x0f, 0x86, 0x1f, 0x80, 0x0f, 0x06, 0x07, 0x0f, 0x1f, 0x1f, 0x3f, 0x3e, 0x3c, 0x9a, 0x00,
+
+    // char 82
+    0x86, 0xfc, 0x82, 0x7c, 0x83, 0xfc, 0x81, 0xf8, 0x04, 0xf0, 0xe0, 0x80, 0x00, 0x00, 0x86, 0xff,
+    0x82, 0xe0, 0x80, 0xf0, 0x00, 0xf9, 0x83, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x00, 0x00, 0x86, 0xff,
+    0x81, 0x03, 0x02, 0x0f, 0x1f, 0x3f, 0x81, 0xff, 0x04, 0xfe, 0xfc, 0xf8, 0xe0, 0xc0, 0x81, 0x00,
+    0x86, 0x0f, 0x85, 0x00, 0x01, 0x03, 0x07, 0x84, 0x0f, 0x00, 0x0c, 0x98, 0x00,
+
+    // char 83
+    0x07, 0x00, 0xe0, 0xf0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0x83, 0x7c, 0x81, 0xfc, 0x80, 0xf8, 0x08,
+    0xf0, 0xe0, 0xc0, 0x00, 0x00, 0x07, 0x1f, 0x3f, 0x7f, 0x82, 0xff, 0x80, 0xfc, 0x82, 0xf8, 0x81,
+    0xf3, 0x80, 0xe3, 0x03, 0xc3, 0x83, 0x00, 0x00, 0x85, 0xf8, 0x02, 0xe1, 0xc1, 0x81, 0x81, 0x83,
+    0x01, 0x87, 0xcf, 0x85, 0xff, 0x05, 0x7e, 0x00, 0x01, 0x03, 0x07, 0x07, 0x8a, 0x0f, 0x80, 0x07,
+    0x01, 0x03, 0x01, 0x97, 0x00,
+
+    // char 84
+    0x96, 0xfc, 0x86, 0x01, 0x86, 0xff, 0x86, 0x01, 0x86, 0x00, 0x86, 0xff, 0x8e, 0x00, 0x86, 0x0f,
+    0x9e, 0x00,
+
+    // char 85
+    0x86, 0xfc, 0x86, 0x00, 0x86, 0xfc, 0x86, 0xff, 0x86, 0x00, 0x86, 0xff, 0x00, 0x3f, 0x85, 0xff,
+    0x00, 0xe0, 0x84, 0xc0, 0x00, 0xe0, 0x85, 0xff, 0x06, 0x3f, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07,
+    0x8a, 0x0f, 0x80, 0x07, 0x01, 0x03, 0x01, 0x98, 0x00,
+
+    // char 86
+    0x01, 0x04, 0x3c, 0x84, 0xfc, 0x01, 0xf8, 0xc0, 0x86, 0x00, 0x01, 0x80, 0xf0, 0x84, 0xfc, 0x06,
+    0x3c, 0x0c, 0x00, 0x00, 0x01, 0x07, 0x3f, 0x83, 0xff, 0x02, 0xfe, 0xf0, 0x80, 0x81, 0x00, 0x01,
+    0xe0, 0xfc, 0x83, 0xff, 0x02, 0x3f, 0x0f, 0x01, 0x85, 0x00, 0x02, 0x01, 0x07, 0x3f, 0x83, 0xff,
+    0x02, 0xfc, 0xf0, 0xfe, 0x82, 0xff, 0x02, 0x3f, 0x0f, 0x01, 0x8c, 0x00, 0x00, 0x07, 0x87, 0x0f,
+    0x00, 0x01, 0xa2, 0x00,
+
+    // char 87
+    0x00, 0x1c, 0x84, 0xfc, 0x01, 0xf8, 0x80, 0x82, 0x00, 0x00, 0xe0, 0x86, 0xfc, 0x00, 0xe0, 0x83,
+    0x00, 0x00, 0xf8, 0x84, 0xfc, 0x03, 0x1c, 0x00, 0x01, 0x3f, 0x84, 0xff, 0x03, 0xe0, 0x00, 0xf0,
+    0xfe, 0x82, 0xff, 0x01, 0x3f, 0x1f, 0x83, 0xff, 0x02, 0xf0, 0x00, 0xe0, 0x84, 0xff, 0x01, 0x3f,
+    0x01, 0x82, 0x00, 0x01, 0x03, 0x7f, 0x88, 0xff, 0x05, 0x1f, 0x01, 0x00, 0x00, 0x01, 0x1f, 0x88,
+    0xff, 0x01, 0x7f, 0x03, 0x86, 0x00, 0x00, 0x07, 0x86, 0x0f, 0x86, 0x00, 0x86, 0x0f, 0x00, 0x07,
+    0xa7, 0x00,
+
+    // char 88
+    0x03, 0x00, 0x04, 0x1c, 0x3c, 0x84, 0xfc, 0x02, 0xf0, 0xe0, 0x80, 0x81, 0x00, 0x02, 0xc0, 0xf0,
+    0xf8, 0x83, 0xfc, 0x02, 0x7c, 0x1c, 0x04, 0x84, 0x00, 0x03, 0x01, 0x07, 0x0f, 0xbf, 0x82, 0xff,
+    0x01, 0xfe, 0xfc, 0x82, 0xff, 0x03, 0xbf, 0x1f, 0x07, 0x03, 0x86, 0x00, 0x04, 0x80, 0xe0, 0xf0,
+    0xfc, 0xfe, 0x82, 0xff, 0x03, 0x3f, 0x1f, 0x0f, 0x3f, 0x82, 0xff, 0x04, 0xfe, 0xfc, 0xf0, 0xe0,
+    0x80, 0x81, 0x00, 0x01, 0x08, 0x0c, 0x85, 0x0f, 0x01, 0x07, 0x01, 0x84, 0x00, 0x01, 0x01, 0x07,
+    0x85, 0x0f, 0x01, 0x0c, 0x08, 0x9a, 0x00,
+
+    // char 89
+    0x03, 0x04, 0x0c, 0x3c, 0x7c, 0x83, 0xfc, 0x02, 0xf8, 0xe0, 0x80, 0x82, 0x00, 0x02, 0x80, 0xe0,
+    0xf0, 0x84, 0xfc, 0x02, 0x3c, 0x1c, 0x04, 0x82, 0x00, 0x04, 0x01, 0x03, 0x0f, 0x1f, 0x7f, 0x82,
+    0xff, 0x80, 0xfc, 0x00, 0xfe, 0x81, 0xff, 0x04, 0x7f, 0x3f, 0x0f, 0x07, 0x01, 0x8c, 0x00, 0x86,
+    0xff, 0x00, 0x01, 0x91, 0x00, 0x86, 0x0f, 0xa4, 0x00,
+
+    // char 90
+    0x00, 0x00, 0x95, 0xfc, 0x85, 0x00, 0x16, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xff, 0xff,
+    0x7f, 0x3f, 0x1f, 0x0f, 0x07, 0x03, 0x01, 0x00, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0x82, 0xff,
+    0x04, 0xdf, 0xcf, 0xc7, 0xc3, 0xc1, 0x87, 0xc0, 0x96, 0x0f, 0x96, 0x00,
+
+    // char 91
+    0x89, 0xfc, 0x85, 0xff, 0x82, 0x00, 0x85, 0xff, 0x82, 0x00, 0x85, 0xff, 0x82, 0xc0, 0x89, 0x07,
+
+    // char 92
+    0x00, 0x0c, 0x81, 0xfc, 0x00, 0xc0, 0x85, 0x00, 0x04, 0x0f, 0xff, 0xff, 0xfc, 0xc0, 0x84, 0x00,
+    0x05, 0x01, 0x1f, 0xff, 0xff, 0xfc, 0xc0, 0x84, 0x00, 0x00, 0x01, 0x81, 0x0f, 0x00, 0x0c, 0x88,
+    0x00,
+
+    // char 93
+    0x89, 0xfc, 0x82, 0x00, 0x85, 0xff, 0x82, 0x00, 0x85, 0xff, 0x82, 0xc0, 0x85, 0xff, 0x89, 0x07,
+
+    // char 94
+    0x83, 0x00, 0x01, 0xc0, 0xf0, 0x84, 0xfc, 0x01, 0xf0, 0xc0, 0x82, 0x00, 0x03, 0x80, 0xe0, 0xf0,
+    0xfc, 0x81, 0xff, 0x05, 0x1f, 0x07, 0x00, 0x01, 0x0f, 0x3f, 0x81, 0xff, 0x02, 0xfc, 0xf0, 0xc0,
+    0xb7, 0x00,
+
+    // char 95
+    0xb4, 0x00, 0x90, 0x80, 0x90, 0x00,
+
+    // char 96
+    0x07, 0x04, 0x0c, 0x1c, 0x3c, 0x7c, 0x7c, 0x70, 0x40, 0x9e, 0x00,
+
+    // char 97
+    0x95, 0x00, 0x07, 0x60, 0x78, 0x78, 0x7c, 0x7c, 0x7e, 0x7e, 0x3e, 0x82, 0x1e, 0x0b, 0x3e, 0xfe,
+    0xfe, 0xfc, 0xfc, 0xf8, 0xf0, 0xc0, 0x00, 0xc0, 0xf0, 0xf8, 0x81, 0xfc, 0x80, 0xfe, 0x05, 0x1e,
+    0x0e, 0x0e, 0x0f, 0x8f, 0xc7, 0x85, 0xff, 0x80, 0x00, 0x01, 0x03, 0x07, 0x87, 0x0f, 0x02, 0x07,
+    0x03, 0x07, 0x84, 0x0f, 0x00, 0x08, 0x94, 0x00,
+
+    // char 98
+    0x85, 0xfc, 0x8c, 0x00, 0x85, 0xff, 0x05, 0xf8, 0x7c, 0x7c, 0x3e, 0x3e, 0x7e, 0x81, 0xfe, 0x04,
+    0xfc, 0xf8, 0xf8, 0xe0, 0x00, 0x85, 0xff, 0x01, 0xf1, 0xc0, 0x81, 0x80, 0x01, 0xc0, 0xfb, 0x84,
+    0xff, 0x00, 0x1f, 0x85, 0x0f, 0x01, 0x03, 0x07, 0x85, 0x0f, 0x80, 0x07, 0x00, 0x03, 0x95, 0x00,
+
+    // char 99
+    0x94, 0x00, 0x08, 0xc0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0x7e, 0x7e, 0x81, 0x3e, 0x08, 0x7e,
+    0xfe, 0xfe, 0xfc, 0xfc, 0xf8, 0xf0, 0xe0, 0x1e, 0x84, 0xff, 0x07, 0xf3, 0xc0, 0x80, 0x80, 0x00,
+    0x80, 0x80, 0xc0, 0x84, 0xe0, 0x80, 0x00, 0x03, 0x01, 0x03, 0x07, 0x07, 0x89, 0x0f, 0x02, 0x07,
+    0x03, 0x03, 0x94, 0x00,
+
+    // char 100
+    0x8c, 0x00, 0x85, 0xfc, 0x04, 0x80, 0xe0, 0xf8, 0xf8, 0xfc, 0x81, 0xfe, 0x05, 0x7e, 0x3e, 0x3e,
+    0x7c, 0x7c, 0xf8, 0x85, 0xff, 0x00, 0x3f, 0x84, 0xff, 0x01, 0xf3, 0xc0, 0x81, 0x80, 0x01, 0xc0,
+    0xf1, 0x85, 0xff, 0x80, 0x00, 0x02, 0x03, 0x07, 0x07, 0x85, 0x0f, 0x01, 0x07, 0x03, 0x85, 0x0f,
+    0x93, 0x00,
+
+    // char 101
+    0x95, 0x00, 0x08, 0xc0, 0xf0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0x3e, 0x3e, 0x81, 0x1e, 0x01, 0x3e,
+    0xfe, 0x81, 0xfc, 0x04, 0xf8, 0xf0, 0xe0, 0x00, 0x3f, 0x85, 0xff, 0x00, 0x8e, 0x82, 0x0e, 0x80,
+    0x8e, 0x84, 0x8f, 0x06, 0x0f, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x89, 0x0f, 0x02, 0x07, 0x03,
+    0x03, 0x96, 0x00,
+
+    // char 102
+    0x81, 0x00, 0x03, 0xe0, 0xf0, 0xf8, 0xf8, 0x81, 0xfc, 0x80, 0x7c, 0x83, 0x3c, 0x85, 0xff, 0x82,
+    0x3c, 0x81, 0x00, 0x85, 0xff, 0x85, 0x00, 0x85, 0x0f, 0x90, 0x00,
+
+    // char 103
+    0x93, 0x00, 0x04, 0x80, 0xe0, 0xf8, 0xfc, 0xfc, 0x81, 0xfe, 0x05, 0x7e, 0x3e, 0x3e, 0x3c, 0x7c,
+    0xf8, 0x85, 0xfe, 0x01, 0x1f, 0x7f, 0x83, 0xff, 0x00, 0xf1, 0x83, 0xc0, 0x00, 0xf1, 0x85, 0xff,
+    0x04, 0x00, 0xe0, 0xe1, 0xe3, 0xe3, 0x81, 0xe7, 0x05, 0xc7, 0x87, 0x87, 0x83, 0x83, 0xc1, 0x84,
+    0xff, 0x04, 0x0f, 0x00, 0x00, 0x01, 0x03, 0x81, 0x07, 0x85, 0x0f, 0x80, 0x07, 0x80, 0x03, 0x02,
+    0x01, 0x00, 0x00,
+
+    // char 104
+    0x85, 0xfc, 0x8b, 0x00, 0x85, 0xff, 0x04, 0xf8, 0x78, 0x7c, 0x7c, 0x7e, 0x82, 0xfe, 0x80, 0xfc,
+    0x01, 0xf8, 0xe0, 0x85, 0xff, 0x84, 0x00, 0x85, 0xff, 0x85, 0x0f, 0x84, 0x00, 0x85, 0x0f, 0x92,
+    0x00,
+
+    // char 105
+    0x86, 0x7c, 0x86, 0xfe, 0x86, 0xff, 0x86, 0x0f, 0x86, 0x00,
+
+    // char 106
+    0x80, 0x00, 0x86, 0x7c, 0x80, 0x00, 0x86, 0xfe, 0x80, 0x00, 0x86, 0xff, 0x80, 0xc0, 0x85, 0xff,
+    0x02, 0x3f, 0x03, 0x07, 0x82, 0x0f, 0x03, 0x07, 0x03, 0x01, 0x00,
+
+    // char 107
+    0x85, 0xfc, 0x8d, 0x00, 0x85, 0xff, 0x0e, 0x80, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc, 0xfe, 0xfe, 0x7e,
+    0x3e, 0x1e, 0x0e, 0x06, 0x02, 0x00, 0x85, 0xff, 0x04, 0x7f, 0x3f, 0x1f, 0x1f, 0x3f, 0x81, 0xff,
+    0x03, 0xfe, 0xf8, 0xf0, 0xc0, 0x81, 0x00, 0x85, 0x0f, 0x84, 0x00, 0x01, 0x03, 0x07, 0x83, 0x0f,
+    0x01, 0x0e, 0x08, 0x94, 0x00,
+
+    // char 108
+    0x86, 0xfc, 0x8e, 0xff, 0x86, 0x0f, 0x86, 0x00,
+
+    // char 109
+    0x9e, 0x00, 0x85, 0xfe, 0x04, 0xf8, 0x78, 0x7c, 0x7e, 0x7e, 0x82, 0xfe, 0x80, 0xfc, 0x80, 0xf0,
+    0x03, 0xf8, 0x7c, 0x7e, 0x7e, 0x82, 0xfe, 0x80, 0xfc, 0x01, 0xf8, 0xe0, 0x85, 0xff, 0x83, 0x00,
+    0x86, 0xff, 0x83, 0x00, 0x85, 0xff, 0x85, 0x0f, 0x83, 0x00, 0x86, 0x0f, 0x83, 0x00, 0x85, 0x0f,
+    0x9e, 0x00,
+
+    // char 110
+    0x92, 0x00, 0x85, 0xfe, 0x04, 0xf0, 0x78, 0x7c, 0x7c, 0x7e, 0x82, 0xfe, 0x80, 0xfc, 0x01, 0xf8,
+    0xe0, 0x85, 0xff, 0x84, 0x00, 0x85, 0xff, 0x85, 0x0f, 0x84, 0x00, 0x85, 0x0f, 0x92, 0x00,
+
+    // char 111
+    0x95, 0x00, 0x07, 0xc0, 0xe0, 0xf8, 0xf8, 0xfc, 0xfc, 0xfe, 0x7e, 0x82, 0x3e, 0x0a, 0x7e, 0xfe,
+    0xfc, 0xfc, 0xf8, 0xf8, 0xf0, 0xc0, 0x00, 0x1f, 0x7f, 0x83, 0xff, 0x01, 0xfb, 0xc0, 0x82, 0x80,
+    0x01, 0xc0, 0xfb, 0x83, 0xff, 0x07, 0x7f, 0x1f, 0x00, 0x00, 0x01, 0x03, 0x07, 0x07, 0x88, 0x0f,
+    0x03, 0x07, 0x03, 0x03, 0x01, 0x96, 0x00,
+
+    // char 112
+    0x93, 0x00, 0x85, 0xfe, 0x05, 0xf8, 0x7c, 0x3c, 0x3e, 0x3e, 0x7e, 0x81, 0xfe, 0x04, 0xfc, 0xf8,
+    0xf0, 0xe0, 0x00, 0x85, 0xff, 0x01, 0xf1, 0xc0, 0x81, 0x80, 0x01, 0xc0, 0xf1, 0x84, 0xff, 0x00,
+    0x3f, 0x85, 0xff, 0x80, 0x07, 0x85, 0x0f, 0x80, 0x07, 0x02, 0x03, 0x00, 0x00, 0x85, 0x07, 0x8c,
+    0x00,
+
+    // char 113
+    0x94, 0x00, 0x0c, 0xe0, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x7e, 0x3e, 0x3e, 0x3c, 0x7c, 0xf8,
+    0x85, 0xfe, 0x00, 0x1f, 0x84, 0xff, 0x01, 0xf1, 0xc0, 0x81, 0x80, 0x01, 0xc0, 0xf1, 0x85, 0xff,
+    0x80, 0x00, 0x00, 0x03, 0x81, 0x07, 0x84, 0x0f, 0x80, 0x07, 0x85, 0xff, 0x8c, 0x00, 0x85, 0x07,
+
+    // char 114
+    0x8c, 0x00, 0x85, 0xfe, 0x06, 0xf8, 0xfc, 0x7e, 0x7e, 0x3e, 0x3e, 0x1e, 0x85, 0xff, 0x00, 0x01,
+    0x84, 0x00, 0x85, 0x0f, 0x93, 0x00,
+
+    // char 115
+    0x93, 0x00, 0x07, 0xf0, 0xf8, 0xfc, 0xfc, 0xfe, 0xfe, 0x9f, 0x9f, 0x81, 0x1f, 0x80, 0x3f, 0x09,
+    0x3e, 0x3c, 0x3c, 0x38, 0x20, 0x00, 0xc0, 0xc1, 0xc3, 0xc7, 0x81, 0xcf, 0x00, 0x8f, 0x82, 0x1f,
+    0x0b, 0x3f, 0xff, 0xff, 0xfe, 0xfe, 0xfc, 0xf8, 0x60, 0x00, 0x03, 0x07, 0x07, 0x8a, 0x0f, 0x02,
+    0x07, 0x03, 0x01, 0x93, 0x00,
+
+    // char 116
+    0x81, 0x00, 0x80, 0xe0, 0x80, 0xf0, 0x81, 0xf8, 0x82, 0x00, 0x81, 0x7e, 0x85, 0xff, 0x82, 0x7e,
+    0x81, 0x00, 0x85, 0xff, 0x82, 0x80, 0x81, 0x00, 0x01, 0x03, 0x07, 0x87, 0x0f, 0x8c, 0x00,
+
+    // char 117
+    0x92, 0x00, 0x85, 0xfe, 0x84, 0x00, 0x85, 0xfe, 0x85, 0xff, 0x05, 0xe0, 0xc0, 0x80, 0x80, 0xc0,
+    0xe0, 0x85, 0xff, 0x02, 0x00, 0x03, 0x07, 0x85, 0x0f, 0x80, 0x07, 0x00, 0x03, 0x85, 0x0f, 0x92,
+    0x00,
+
+    // char 118
+    0x94, 0x00, 0x02, 0x02, 0x1e, 0x7e, 0x82, 0xfe, 0x01, 0xfc, 0xe0, 0x82, 0x00, 0x01, 0xc0, 0xf8,
+    0x82, 0xfe, 0x02, 0x7e, 0x1e, 0x06, 0x81, 0x00, 0x02, 0x03, 0x0f, 0x3f, 0x82, 0xff, 0x02, 0xf8,
+    0xf0, 0xfe, 0x81, 0xff, 0x02, 0x3f, 0x0f, 0x03, 0x87, 0x00, 0x01, 0x01, 0x07, 0x84, 0x0f, 0x01,
+    0x07, 0x01, 0x9a, 0x00,
+
+    // char 119
+    0xa0, 0x00, 0x01, 0x06, 0x1e, 0x83, 0xfe, 0x01, 0xf8, 0x80, 0x81, 0x00, 0x01, 0xe0, 0xfc, 0x84,
+    0xfe, 0x01, 0xfc, 0xe0, 0x82, 0x00, 0x00, 0xf0, 0x83, 0xfe, 0x01, 0x3e, 0x06, 0x81, 0x00, 0x01,
+    0x07, 0x1f, 0x82, 0xff, 0x01, 0xf8, 0xf0, 0x82, 0xff, 0x03, 0x1f, 0x03, 0x03, 0x1f, 0x82, 0xff,
+    0x01, 0xf8, 0xf0, 0x82, 0xff, 0x01, 0x3f, 0x07, 0x87, 0x00, 0x00, 0x07, 0x85, 0x0f, 0x00, 0x01,
+    0x83, 0x00, 0x00, 0x07, 0x84, 0x0f, 0x00, 0x07, 0xa6, 0x00,
+
+    // char 120
+    0x94, 0x00, 0x03, 0x06, 0x0e, 0x1e, 0x7e, 0x82, 0xfe, 0x06, 0xfc, 0xf0, 0xc0, 0xc0, 0xf0, 0xf8,
+    0xfc, 0x81, 0xfe, 0x09, 0x7e, 0x1e, 0x0e, 0x06, 0x00, 0x00, 0x80, 0xc0, 0xf0, 0xfb, 0x82, 0xff,
+    0x80, 0x7f, 0x82, 0xff, 0x07, 0xf9, 0xf0, 0xc0, 0x80, 0x00, 0x00, 0x0c, 0x0e, 0x83, 0x0f, 0x01,
+    0x07, 0x03, 0x81, 0x00, 0x02, 0x01, 0x03, 0x07, 0x83, 0x0f, 0x01, 0x0e, 0x0c, 0x94, 0x00,
+
+    // char 121
+    0x94, 0x00, 0x02, 0x02, 0x1e, 0x7e, 0x82, 0xfe, 0x02, 0xfc, 0xf0, 0x80, 0x81, 0x00, 0x01, 0x80,
+    0xf8, 0x83, 0xfe, 0x01, 0x3e, 0x06, 0x81, 0x00, 0x02, 0x01, 0x0f, 0x3f, 0x82, 0xff, 0x02, 0xf8,
+    0xe0, 0xfc, 0x82, 0xff, 0x01, 0x3f, 0x07, 0x82, 0x00, 0x80, 0xc0, 0x80, 0x80, 0x02, 0xc0, 0xc1,
+    0xe7, 0x84, 0xff, 0x01, 0x3f, 0x07, 0x85, 0x00, 0x02, 0x03, 0x07, 0x07, 0x83, 0x0f, 0x80, 0x07,
+    0x01, 0x03, 0x01, 0x87, 0x00,
+
+    // char 122
+    0x90, 0x00, 0x85, 0x3e, 0x00, 0xbe, 0x86, 0xfe, 0x07, 0x7e, 0x3e, 0xc0, 0xe0, 0xf0, 0xf8, 0xfc,
+    0xfe, 0x81, 0xff, 0x05, 0xbf, 0x9f, 0x8f, 0x87, 0x83, 0x81, 0x81, 0x80, 0x90, 0x0f, 0x90, 0x00,
+
+    // char 123
+    0x82, 0x00, 0x02, 0xe0, 0xf8, 0xf8, 0x84, 0xfc, 0x04, 0x78, 0x00, 0x80, 0x80, 0xc0, 0x84, 0xff,
+    0x00, 0x01, 0x81, 0x00, 0x03, 0x1f, 0x3f, 0x3f, 0x7f, 0x82, 0xff, 0x01, 0xf3, 0xe0, 0x86, 0x00,
+    0x84, 0xff, 0x00, 0xf0, 0x81, 0xc0, 0x82, 0x00, 0x01, 0x01, 0x03, 0x81, 0x07, 0x82, 0x0f, 0x00,
+    0x07,
+
+    // char 124
+    0x82, 0xfc, 0x8a, 0xff, 0x82, 0x07,
+
+    // char 125
+    0x00, 0x78, 0x84, 0xfc, 0x80, 0xf8, 0x00, 0xe0, 0x85, 0x00, 0x00, 0x01, 0x84, 0xff, 0x02, 0xc0,
+    0x80, 0x80, 0x83, 0x00, 0x01, 0xe0, 0xf3, 0x82, 0xff, 0x03, 0x7f, 0x3f, 0x3f, 0x1f, 0x81, 0xc0,
+    0x00, 0xf0, 0x84, 0xff, 0x82, 0x00, 0x00, 0x07, 0x81, 0x0f, 0x82, 0x07, 0x01, 0x03, 0x01, 0x82,
+    0x00,
+
+    // char 126
+    0x92, 0x00, 0x02, 0xe0, 0xf0, 0xf0, 0x84, 0xf8, 0x80, 0xf0, 0x80, 0xe0, 0x81, 0xc0, 0x80, 0xe0,
+    0x03, 0xf0, 0xf8, 0x07, 0x03, 0x84, 0x01, 0x81, 0x03, 0x84, 0x07, 0x80, 0x03, 0x00, 0x01, 0xa6,
+    0x00,
+
+    // char 127
+};
+
+#endif
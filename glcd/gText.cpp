@@ -25,12 +25,7 @@
 #include "include/gText.h"
 #include "glcd_Config.h" 
 
-#ifndef GLCD_NO_PRINTF
-extern "C"
-{
-#include <stdio.h>
-}
-#endif
+#include <string.h>
 
 /*
  * Experimental defines
@@ -38,6 +33,18 @@ extern "C"
 
 //#define GLCD_OLD_FONTDRAW    // uncomment this define to get old font rendering (not recommended)
 
+#define GLYPH_BATCH 8	// most characters drawn together by PutRun(), each takes 3 bytes of stack
+
+#ifdef GLCD_FONT_INDEX
+/*
+ * Offset (in columns) of the glyph data for each character of the
+ * last variable width font rendered. Like FontRead, this is shared
+ * by all instances so it costs 2 bytes per character only once.
+ */
+static Font_t	IndexFont;
+static uint16_t	FontIndex[GLCD_FONT_INDEX];
+#endif
+
 	
 //extern glcd_Device GLCD; // this is the global GLCD instance, here upcast to the base glcd_Device class 
 
@@ -260,145 +267,185 @@ TareaToken tok;
 }
 
 /*
- * Scroll a pixel region up.
+ * number of columns scrolled together, each one needs 3 bytes of stack
+ */
+#ifndef GLCD_SCROLL_SPAN
+#define GLCD_SCROLL_SPAN 16
+#endif
+
+/*
+ * read count LCD page bytes starting at column x, page sp of a scroll region
+ * Pages outside of the region (first through last) are not read
+ * since any pixels from them are replaced by the fill color.
+ */
+void gText::ScrollRead(uint8_t x, uint8_t count, int16_t sp, uint8_t first, uint8_t last, uint8_t *data)
+{
+	if(sp < first || sp > last)
+		memset(data, 0, count);
+	else
+		glcd_Device::ReadSpan(x, sp * 8, count, data);
+}
+
+/*
+ * Scroll a pixel region up or down.
  * 	Area scrolled is defined by x1,y1 through x2,y2 inclusive.
  *  x1,y1 is upper left corder, x2,y2 is lower right corner.
  *
- *	color is the color to be used for the created space along the
- *	bottom.
- *
- *	pixels is the *exact* pixels to scroll. 1 is 1 and 9 is 9 it is
- *  not 1 less or 1 more than what you want. It is *exact*.
+ *	delta is the *exact* number of pixels to scroll,
+ *	positive to scroll up and negative to scroll down.
+ *
+ *	color is the color to be used for the created space.
+ *
+ * The region is done GLCD_SCROLL_SPAN columns at a time, one LCD page
+ * row of them at a time.
+ * The new bytes for a page are the two source bytes delta pixels away
+ * shifted and merged together, so each source byte is read once
+ * and each destination byte is written once.
+ * The source, destination and partial page reads are each a single run
+ * of bytes using the column auto-increment of the glcd, not a GotoXY()
+ * for every byte.
+ * Pages are done in the direction of the scroll so source bytes are always
+ * read before they are overwritten.
  */
-
-void gText::ScrollUp(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
-	uint8_t pixels, uint8_t color)
+void gText::ScrollArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
+	int16_t delta, uint8_t color)
 {
-uint8_t dy;
-uint8_t dbyte;
-uint8_t sy;
-uint8_t sbyte;
-uint8_t col;
-
-	/*
-	 * Scrolling up more than area height?
-	 */
-	if(y1 + pixels > y2)
+uint8_t x, count, i;
+uint8_t page, first, last, end;
+int8_t step;
+int16_t sp;
+uint8_t b;
+uint8_t buf[3][GLCD_SCROLL_SPAN];
+uint8_t *lo, *hi, *tmp;
+uint8_t *data = buf[2];
+uint8_t region, fill;
+int16_t f;
+
+	first = y1/8;
+	last = y2/8;
+	b = delta & 7;	/* bit offset of the source pixels in the source byte */
+
+	if(delta > 0)
 	{
-		/*
-		 * fill the region with "whitespace" because
-		 * it is being totally scrolled out.
-		 */
-		glcd_Device::SetPixels(x1, y1, x2, y2, color);
-		return;
+		step = 1;
+		end = last;
 	}
-
-	for(col = x1; col <= x2; col++)
+	else
 	{
-		dy = y1;
-		glcd_Device::GotoXY(col, dy & ~7);
-		dbyte = glcd_Device::ReadData();
+		step = -1;
+		end = first;
+	}
 
+	for(x = x1; x <= x2; x += count)
+	{
+		count = x2 - x + 1;
+		if(count > GLCD_SCROLL_SPAN)
+			count = GLCD_SCROLL_SPAN;
 
 		/*
-		 * preserve bits outside/above scroll region
+		 * on a page boundary the source is a single page, hi is not used
 		 */
+		lo = buf[0];
+		hi = b ? buf[1] : buf[0];
 
-		dbyte &= (_BV((dy & 7)) - 1);
-
-		sy = dy + pixels;
-		glcd_Device::GotoXY(col, sy & ~7);
-		sbyte = glcd_Device::ReadData();
+		page = delta > 0 ? first : last;
+		sp = ((int16_t)page * 8 + delta) >> 3;	/* source page for the first row of page */
+		this->ScrollRead(x, count, sp, first, last, lo);
+		if(b)
+			this->ScrollRead(x, count, sp+1, first, last, hi);
 
-		while(sy <= y2)
+		for(;;)
 		{
-			if(sbyte & _BV(sy & 7))
+			/*
+			 * Bits of this page inside the region
+			 */
+			region = 0xff;
+			if(page == first)
+				region &= 0xff << (y1 & 7);
+			if(page == last)
+				region &= 0xff >> (7 - (y2 & 7));
+
+			/*
+			 * Bits for rows whose source is outside the region
+			 */
+			if(delta > 0)
 			{
-				dbyte |= _BV(dy & 7);
+				f = y2 - delta + 1 - page*8;	/* first row filled */
+				fill = f <= 0 ? 0xff : (f < 8 ? 0xff << f : 0);
 			}
-
-			sy++;
-			if((sy & 7) == 0)
+			else
 			{
-				/*
-				 * If we just crossed over, then we should be done.
-				 */
-				if(sy < DISPLAY_HEIGHT)
-				{
-					glcd_Device::GotoXY(col, sy & ~7);
-					sbyte = glcd_Device::ReadData();
-				}
+				f = y1 - delta - page*8;		/* first row not filled */
+				fill = f >= 8 ? 0xff : (f > 0 ? 0xff >> (8 - f) : 0);
 			}
+			fill &= region;
+
+			/*
+			 * preserve bits outside scroll region
+			 */
+			if(region != 0xff)
+				glcd_Device::ReadSpan(x, page * 8, count, data);
 
-			if((dy & 7) == 7)
+			for(i = 0; i < count; i++)
 			{
-				glcd_Device::GotoXY(col, dy & ~7);	// Should be able to remove this
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
+				uint8_t d = ((lo[i] >> b) | (hi[i] << (8 - b))) & region & ~fill;
+				if(color == BLACK)
+					d |= fill;
+				if(region != 0xff)
+					d |= data[i] & ~region;
+				data[i] = d;
 			}
-			dy++;
-		}
 
-		/*
-		 * Handle the new area at the bottom of the region
-		 */
+			glcd_Device::WriteSpan(x, page * 8, count, data);
 
-		for(uint8_t p = pixels; p; p--)
-		{
-			if(color == BLACK)
+			if(page == end)
+				break;
+
+			page += step;
+			sp += step;
+			if(step > 0)
 			{
-				dbyte |= _BV(dy & 7);
+				if(b)
+				{
+					tmp = lo;
+					lo = hi;
+					hi = tmp;
+					this->ScrollRead(x, count, sp+1, first, last, hi);
+				}
+				else
+				{
+					this->ScrollRead(x, count, sp, first, last, lo);
+				}
 			}
 			else
 			{
-				dbyte &= ~_BV(dy & 7);
-			}
-
-			if((dy & 7) == 7)
-			{
-				glcd_Device::GotoXY(col, dy & ~7); // should be able to remove this.
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
+				if(b)
+				{
+					tmp = hi;
+					hi = lo;
+					lo = tmp;
+				}
+				this->ScrollRead(x, count, sp, first, last, lo);
 			}
-			dy++;
-		}
-
-		/*
-		 * Flush out the final destination byte
-		 */
-
-
-		if(dy & 7)
-		{
-			dy--;
-
-			glcd_Device::GotoXY(col, dy & ~7);
-			sbyte = glcd_Device::ReadData();
-			/*
-			 * Preserver bits outside/below region
-			 */
-
-			dy++;
-			sbyte &= ~(_BV((dy & 7)) - 1);
-			dbyte |= sbyte;
-
-			glcd_Device::WriteData(dbyte);
 		}
 	}
-
 }
 
-#ifndef GLCD_NO_SCROLLDOWN
+/*
+ * Scroll a pixel region up.
+ * 	Area scrolled is defined by x1,y1 through x2,y2 inclusive.
+ *  x1,y1 is upper left corder, x2,y2 is lower right corner.
+ *
+ *	color is the color to be used for the created space along the
+ *	bottom.
+ *
+ *	pixels is the *exact* pixels to scroll. 1 is 1 and 9 is 9 it is
+ *  not 1 less or 1 more than what you want. It is *exact*.
+ */
 
-void gText::ScrollDown(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
+void gText::ScrollUp(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
 	uint8_t pixels, uint8_t color)
 {
-uint8_t dy;
-uint8_t dbyte;
-uint8_t sy;
-uint8_t sbyte;
-uint8_t col;
-
 	/*
 	 * Scrolling up more than area height?
 	 */
@@ -412,94 +459,50 @@ uint8_t col;
 		return;
 	}
 
+#ifdef GLCD_HW_SCROLL
 	/*
-	 * Process region from left to right
+	 * The full display can be scrolled by whole pages
+	 * by moving the display start line.
 	 */
-	for(col = x1; col <= x2; col++)
+	if(x1 == 0 && y1 == 0 && x2 == DISPLAY_WIDTH-1 && y2 == DISPLAY_HEIGHT-1 && !(pixels & 7)
+		&& glcd_Device::ScrollPages(pixels/8))
 	{
-		dy = y2;
-		glcd_Device::GotoXY(col, dy & ~7);
-		dbyte = glcd_Device::ReadData();
-
-		/*
-		 * preserve bits outside/below scroll region
-		 */
-
-		dbyte &= ~(_BV(((dy & 7)+1)) - 1);
-		sy = dy - pixels;
-		glcd_Device::GotoXY(col, sy & ~7);
-		sbyte = glcd_Device::ReadData();
-
-		while(sy >= y1)
-		{
-			if(sbyte & _BV(sy & 7))
-			{
-				dbyte |= _BV(dy & 7);
-			}
-			if((dy & 7) == 0)
-			{
-				glcd_Device::GotoXY(col, dy & ~7);	// Should be able to remove this
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy--;
-
-			if(!sy)
-				break; /* if we bottomed out, we are done */
-			sy--;
-			if((sy & 7) == 7)
-			{
-				glcd_Device::GotoXY(col, sy & ~7);
-				sbyte = glcd_Device::ReadData();
-			}
-
-		}
-
-		/*
-		 * Handle the new area at the top of the column
-		 */
-
-		for(uint8_t p = pixels; p; p--)
-		{
-			if(color == BLACK)
-			{
-				dbyte |= _BV(dy & 7);
-			}
-			else
-			{
-				dbyte &= ~_BV(dy & 7);
-			}
+		glcd_Device::SetPixels(0, DISPLAY_HEIGHT - pixels, DISPLAY_WIDTH-1, DISPLAY_HEIGHT-1, color);
+		return;
+	}
+#endif
 
-			if((dy & 7) == 0)
-			{
-				glcd_Device::GotoXY(col, dy & ~7); // should be able to remove this.
-				glcd_Device::WriteData(dbyte);
-				dbyte = 0;
-			}
-			dy--;
-		}
+	this->ScrollArea(x1, y1, x2, y2, pixels, color);
+}
 
-		dy++; /* point dy back to last destination row */
+#ifndef GLCD_NO_SCROLLDOWN
 
+void gText::ScrollDown(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, 
+	uint8_t pixels, uint8_t color)
+{
+	/*
+	 * Scrolling up more than area height?
+	 */
+	if(y1 + pixels > y2)
+	{
 		/*
-		 * Flush out the final destination byte
+		 * fill the region with "whitespace" because
+		 * it is being totally scrolled out.
 		 */
+		glcd_Device::SetPixels(x1, y1, x2, y2, color);
+		return;
+	}
 
-		if(dy & 7)
-		{
-			glcd_Device::GotoXY(col, dy & ~7);
-			sbyte = glcd_Device::ReadData();
-			/*
-			 * Preserve bits outside/above region
-			 */
-
-			sbyte &= (_BV((dy & 7)) - 1);
-			dbyte |= sbyte;
-			glcd_Device::WriteData(dbyte);
-		}
-
+#ifdef GLCD_HW_SCROLL
+	if(x1 == 0 && y1 == 0 && x2 == DISPLAY_WIDTH-1 && y2 == DISPLAY_HEIGHT-1 && !(pixels & 7)
+		&& glcd_Device::ScrollPages(-(pixels/8)))
+	{
+		glcd_Device::SetPixels(0, 0, DISPLAY_WIDTH-1, pixels-1, color);
+		return;
 	}
+#endif
 
+	this->ScrollArea(x1, y1, x2, y2, -pixels, color);
 }
 #endif //GLCD_NO_SCROLLDOWN
 
@@ -659,6 +662,49 @@ void gText::SpecialChar(uint8_t c)
 
 }
 
+#ifndef GLCD_OLD_FONTDRAW
+/*
+ * clear the bits of a font data byte that are below the glyph.
+ * Only the last row of a glyph whose height is not a multiple of 8
+ * has any, and some fonts have stray bits set there.
+ */
+static inline uint8_t FontMask(uint8_t fdata, uint8_t row, uint8_t height)
+{
+	if((height - row*8) < 8)
+		fdata &= (1 << (height & 7)) - 1;
+	return(fdata);
+}
+
+/*
+ * fetch the font data byte for 8 pixel row "row" of a glyph column.
+ *
+ * Pixels below the glyph read as 0 and the residual bits of the last
+ * row of a Thiele variable width font are shifted down to bit 0
+ * to line up with LCD memory.
+ */
+static inline uint8_t FontByte(Font_t ptr, uint8_t row, uint8_t height, uint8_t thielefont)
+{
+uint8_t fdata;
+
+	if(row*8 >= height)
+		return(0);
+
+	fdata = FontRead(ptr);
+
+	/*
+	 * Have to shift font data because Thiele shifted residual
+	 * font bits the wrong direction for LCD memory.
+	 *
+	 * The real solution to this is to fix the variable width font format to
+	 * not shift the residual bits the wrong direction!!!!
+	 */
+	if(thielefont && (height - row*8) < 8)
+		fdata >>= 8 - (height & 7);
+
+	return(FontMask(fdata, row, height));
+}
+#endif
+
 /**
  * output a character
  *
@@ -682,6 +728,9 @@ void gText::SpecialChar(uint8_t c)
 
 int gText::PutChar(uint8_t c)
 {
+fontInfo font;
+glyphInfo glyph;
+
     if(this->Font == 0)
 	  return 0; // no font selected
 
@@ -695,58 +744,9 @@ int gText::PutChar(uint8_t c)
 		return 1;
 	}
 	   
-	uint8_t width = 0;
-	uint8_t height = FontRead(this->Font+FONT_HEIGHT);
-	uint8_t bytes = (height+7)/8; /* calculates height in rounded up bytes */
-	
-	uint8_t firstChar = FontRead(this->Font+FONT_FIRST_CHAR);
-	uint8_t charCount = FontRead(this->Font+FONT_CHAR_COUNT);
-	
-	uint16_t index = 0;
-	uint8_t thielefont;
-
-	if(c < firstChar || c >= (firstChar+charCount)) {
+	this->GetFontInfo(&font);
+	if(!this->FindGlyph(c, &font, &glyph))
 		return 0; // invalid char
-	}
-	c-= firstChar;
-
-	if( isFixedWidthFont(this->Font) {
-		thielefont = 0;
-		width = FontRead(this->Font+FONT_FIXED_WIDTH); 
-		index = c*bytes*width+FONT_WIDTH_TABLE;
-	}
-	else{
-	// variable width font, read width data, to get the index
-		thielefont = 1;
-		/*
-		 * Because there is no table for the offset of where the data
-		 * for each character glyph starts, run the table and add up all the
-		 * widths of all the characters prior to the character we
-		 * need to locate.
-		 */
-	   for(uint8_t i=0; i<c; i++) {  
-		 index += FontRead(this->Font+FONT_WIDTH_TABLE+i);
-	   }
-		/*
-		 * Calculate the offset of where the font data
-		 * for our character starts.
-		 * The index value from above has to be adjusted because
-		 * there is potentialy more than 1 byte per column in the glyph,
-		 * when the characgter is taller than 8 bits.
-		 * To account for this, index has to be multiplied
-		 * by the height in bytes because there is one byte of font
-		 * data for each vertical 8 pixels.
-		 * The index is then adjusted to skip over the font width data
-		 * and the font header information.
-		 */
-
-	   index = index*bytes+charCount+FONT_WIDTH_TABLE;
-
-		/*
-		 * Finally, fetch the width of our character
-		 */
-	   width = FontRead(this->Font+FONT_WIDTH_TABLE+c);
-    }
 
 #ifndef GLCD_NODEFER_SCROLL
 	/*
@@ -769,7 +769,7 @@ int gText::PutChar(uint8_t c)
 	 * NOTE/WARNING: the below calculation assumes a 1 pixel pad.
 	 * This will need to be changed if/when configurable pixel padding is supported.
 	 */
-	if(this->x + width > this->tarea.x2)
+	if(this->x + glyph.width > this->tarea.x2)
 	{
 		this->PutChar('\n'); // fake a newline to cause wrap/scroll
 #ifndef GLCD_NODEFER_SCROLL
@@ -788,6 +788,16 @@ int gText::PutChar(uint8_t c)
 	// last but not least, draw the character
 
 #ifdef GLCD_OLD_FONTDRAW
+	uint8_t width = glyph.width;
+	uint16_t index = glyph.index;
+	uint8_t height = font.height;
+	uint8_t bytes = (height+7)/8;
+	uint8_t rlefont = font.rle;
+	rleStream rle;
+
+	if(rlefont)
+		RleStart(&rle, this->Font+index, FontRead);
+
 /*================== OLD FONT DRAWING ============================*/
 	glcd_Device::GotoXY(this->x, this->y);
 
@@ -806,7 +816,7 @@ int gText::PutChar(uint8_t c)
 		uint16_t page = i*width; // page must be 16 bit to prevent overflow
 		for(uint8_t j=0; j<width; j++) /* each column */
 		{
-			uint8_t data = FontRead(this->Font+index+page+j);
+			uint8_t data = rlefont ? RleRead(&rle) : FontRead(this->Font+index+page+j);
 		
 			/*
 			 * This funkyness is because when the character glyph is not a
@@ -819,7 +829,7 @@ int gText::PutChar(uint8_t c)
 			 *	--- bperrybap
 			 */
 
-			if(height > 8 && height < (i+1)*8)	/* is it last byte of multibyte tall font? */
+			if(height > 8 && height < (i+1)*8 && !rlefont)	/* is it last byte of multibyte tall font? */
 			{
 				data >>= (i+1)*8-height;
 			}
@@ -842,6 +852,117 @@ int gText::PutChar(uint8_t c)
 
 /*================== END of OLD FONT DRAWING ============================*/
 #else
+	this->DrawGlyphs(&font, &glyph, 1);
+#endif
+
+	return 1; // valid char
+}
+
+/*
+ * read the header of the current font
+ */
+void gText::GetFontInfo(fontInfo *font)
+{
+	font->height = FontRead(this->Font+FONT_HEIGHT);
+	font->firstChar = FontRead(this->Font+FONT_FIRST_CHAR);
+	font->charCount = FontRead(this->Font+FONT_CHAR_COUNT);
+	font->fixedWidth = 0;
+	font->rle = 0;
+
+	if( isFixedWidthFont(this->Font) {
+		font->fixedWidth = FontRead(this->Font+FONT_FIXED_WIDTH); 
+	}
+	else if(isRleFont(this->Font)) {
+		font->rle = 1;
+	}
+}
+
+/*
+ * look up the glyph data offset and width of character c in the current font
+ *
+ * Returns 0 if the font has no glyph for c.
+ */
+uint8_t gText::FindGlyph(uint8_t c, fontInfo *font, glyphInfo *glyph)
+{
+	uint8_t width = 0;
+	uint8_t bytes = (font->height+7)/8; /* calculates height in rounded up bytes */
+	uint8_t charCount = font->charCount;
+	uint16_t index = 0;
+
+	if(c < font->firstChar || c >= (font->firstChar+charCount)) {
+		return 0; // invalid char
+	}
+	c-= font->firstChar;
+
+	if(font->fixedWidth) {
+		width = font->fixedWidth;
+		index = c*bytes*width+FONT_WIDTH_TABLE;
+	}
+	else if(font->rle) {
+		/*
+		 * compressed font, the glyph offset is in the table
+		 * following the widths.
+		 */
+		index = FONT_WIDTH_TABLE+charCount+c*2;
+		index = (FontRead(this->Font+index) << 8 | FontRead(this->Font+index+1)) + FONT_WIDTH_TABLE+charCount*3;
+		width = FontRead(this->Font+FONT_WIDTH_TABLE+c);
+	}
+	else{
+	// variable width font, read width data, to get the index
+		/*
+		 * Because there is no table for the offset of where the data
+		 * for each character glyph starts, run the table and add up all the
+		 * widths of all the characters prior to the character we
+		 * need to locate.
+		 */
+#ifdef GLCD_FONT_INDEX
+	   index = this->GlyphIndex(c, charCount);
+#else
+	   for(uint8_t i=0; i<c; i++) {  
+		 index += FontRead(this->Font+FONT_WIDTH_TABLE+i);
+	   }
+#endif
+		/*
+		 * Calculate the offset of where the font data
+		 * for our character starts.
+		 * The index value from above has to be adjusted because
+		 * there is potentialy more than 1 byte per column in the glyph,
+		 * when the characgter is taller than 8 bits.
+		 * To account for this, index has to be multiplied
+		 * by the height in bytes because there is one byte of font
+		 * data for each vertical 8 pixels.
+		 * The index is then adjusted to skip over the font width data
+		 * and the font header information.
+		 */
+
+	   index = index*bytes+charCount+FONT_WIDTH_TABLE;
+
+		/*
+		 * Finally, fetch the width of our character
+		 */
+	   width = FontRead(this->Font+FONT_WIDTH_TABLE+c);
+    }
+
+	glyph->index = index;
+	glyph->width = width;
+	return 1;
+}
+
+#ifndef GLCD_OLD_FONTDRAW
+/*
+ * draw count glyphs side by side at the current text position
+ *
+ * The caller has made sure they all fit on the current text line.
+ * Each LCD page is painted across all the glyphs before moving down
+ * to the next one, so a run of characters is one sequential stream
+ * of writes per LCD page.
+ */
+void gText::DrawGlyphs(fontInfo *font, glyphInfo *glyphs, uint8_t count)
+{
+	uint8_t height = font->height;
+	uint8_t bytes = (height+7)/8; /* calculates height in rounded up bytes */
+	uint8_t rlefont = font->rle;
+	uint8_t thielefont = !rlefont && !font->fixedWidth;
 
 /*================== NEW FONT DRAWING ===================================*/
 
@@ -861,213 +982,149 @@ int gText::PutChar(uint8_t c)
 	 * i.e it ensures the absolute minimum number of LCD page accesses
 	 * as well as does the sequential writes as much as possible.
 	 *
+	 * The font pixels for each LCD page byte are lined up with a shift of
+	 * at most two font data bytes and merged in with a mask,
+	 * so no pixel is painted on its own.
+	 * When the text is on a page boundary, the LCD page is not read at all.
+	 *
 	 */
 
 	uint8_t pixels = height +1; /* 1 for gap below character*/
 	uint8_t p;
 	uint8_t dy;
-	uint8_t tfp;
 	uint8_t dp;
+	uint8_t fp;
+	uint8_t n;
+	uint8_t mask;
 	uint8_t dbyte;
 	uint8_t fdata;
+	uint8_t g;
+	uint8_t width;
+	uint8_t twopage;
+	rleStream rcur;		/* compressed font data for this font page */
+	rleStream rnext;	/* compressed font data for the next font page */
+
+	for(p = 0; p < pixels; p += n)
+	{
+		dy = this->y + p;
+		dp = dy & 7;	/* data byte pixel bit position */
+		fp = p & 7;		/* font pixel bit position 		*/
+
+		/*
+		 * The rest of the glyphs are below the bottom of the display.
+		 * GotoXY() would not move there and the writes would land
+		 * on the page above, to the right of the glyphs.
+		 */
+		if(dy >= DISPLAY_HEIGHT)
+			break;
+
+		/*
+		 * Number of pixels painted in this LCD page
+		 * and the mask of their bits in the LCD page byte.
+		 */
+		n = 8 - dp;
+		if(n > pixels - p)
+			n = pixels - p;
+		mask = (0xff >> (8 - n)) << dp;
 
-	for(p = 0; p < pixels;)
-	{
-		dy = this->y + p;
+		/*
+		 * true when the pixels come from two font pages
+		 */
+		twopage = fp && n > 8 - fp;
 
 		/*
-		 * Align to proper Column and page in LCD memory
+		 * Align to proper Column and page in LCD memory.
+		 * The glyphs follow each other with no gaps in LCD memory
+		 * so the columns after the first one need no positioning.
 		 */
 
 		glcd_Device::GotoXY(this->x, (dy & ~7));
 
-		uint16_t page = p/8 * width; // page must be 16 bit to prevent overflow
-
-		for(uint8_t j=0; j<width; j++) /* each column of font data */
+		for(g = 0; g < count; g++)
 		{
-			
+			width = glyphs[g].width;
+			Font_t fontdata = this->Font+glyphs[g].index + p/8 * width;
+
 			/*
-			 * Fetch proper byte of font data.
-			 * Note:
-			 * This code "cheats" to add the horizontal space/pixel row
-			 * below the font.
-			 * It essentially creates a font pixel of 0 when the pixels are
-			 * out of the defined pixel map.
-			 *
-			 * fake a fondata read read when we are on the very last
-			 * bottom "pixel". This lets the loop logic continue to run
-			 * with the extra fake pixel. If the loop is not the
-			 * the last pixel the pixel will come from the actual
-			 * font data, but that is ok as it is 0 padded.
-			 *
+			 * Compressed font data can only be decoded in order, so the decoder
+			 * for this font page is skipped over the pages above it,
+			 * and the decoder for the next font page is a copy skipped over this page.
 			 */
-
-			if(p >= height)
-			{
-				/*
-				 * fake a font data read for padding below character.
-				 */
-				fdata = 0;
-			}
-			else
+			if(rlefont && p/8 < bytes)
 			{
-				fdata = FontRead(this->Font+index+page+j);
-
-				/*
-				 * Have to shift font data because Thiele shifted residual
-				 * font bits the wrong direction for LCD memory.
-				 *
-				 * The real solution to this is to fix the variable width font format to
-				 * not shift the residual bits the wrong direction!!!!
-				 */
-				if(thielefont && (height - (p&~7)) < 8)
+				RleStart(&rcur, this->Font+glyphs[g].index, FontRead);
+				RleSkip(&rcur, p/8 * width);
+				if(twopage && p/8+1 < bytes)
 				{
-					fdata >>= 8 - (height & 7);
+					rnext = rcur;
+					RleSkip(&rnext, width);
 				}
 			}
 
-			if(this->FontColor == WHITE)
-				fdata ^= 0xff;	/* inverted data for "white" font color	*/
-
-
-			/*
-			 * Check to see if a quick full byte write of font
-			 * data can be done.
-			 */
-
-			if(!(dy & 7) && !(p & 7) && ((pixels -p) >= 8))
+			for(uint8_t j=0; j<width; j++) /* each column of font data */
 			{
 				/*
-				 * destination pixel is on a page boundary
-				 * Font data is on byte boundary
-				 * And there are 8 or more pixels left
-				 * to paint so a full byte write can be done.
+				 * Fetch the 8 font pixels starting at p.
+				 * When they don't start on a font byte boundary, the
+				 * rest come from the same column in the next font byte.
 				 */
-					
-					glcd_Device::WriteData(fdata);
-					continue;
-			}
-			else
-			{
-					/*
-					 * No, so must fetch byte from LCD memory.
-					 */
-					dbyte = glcd_Device::ReadData();
-			}
-
-			/*
-			 * At this point there is either not a full page of data
-			 * left to be painted  or the font data spans multiple font
-			 * data bytes. (or both) So, the font data bits will be painted
-			 * into a byte and then written to the LCD memory.page.
-			 */
-
-
-			tfp = p;		/* font pixel bit position 		*/
-			dp = dy & 7;	/* data byte pixel bit position */
-
-			/*
-			 * paint bits until we hit bottom of page/byte
-			 * or run out of pixels to paint.
-			 */
-			while((dp <= 7) && (tfp) < pixels)
-			{
-				if(fdata & _BV(tfp & 7))
+				if(rlefont)
 				{
-					dbyte |= _BV(dp);
+					fdata = p/8 < bytes ? FontMask(RleRead(&rcur), p/8, height) >> fp : 0;
+					if(twopage && p/8+1 < bytes)
+						fdata |= FontMask(RleRead(&rnext), p/8+1, height) << (8 - fp);
 				}
 				else
 				{
-					dbyte &= ~_BV(dp);
+					fdata = FontByte(fontdata+j, p/8, height, thielefont) >> fp;
+					if(twopage)
+						fdata |= FontByte(fontdata+j+width, p/8+1, height, thielefont) << (8 - fp);
 				}
 
-				/*
-				 * Check for crossing font data bytes
-				 */
-				if((tfp & 7)== 7)
-				{
-					fdata = FontRead(this->Font+index+page+j+width);
+				if(this->FontColor == WHITE)
+					fdata ^= 0xff;	/* inverted data for "white" font color	*/
 
+				if(mask == 0xff)
+				{
 					/*
-					 * Have to shift font data because Thiele shifted residual
-					 * font bits the wrong direction for LCD memory.
-					 *
+					 * The whole LCD page is painted so the font data
+					 * is written as is, with no read of LCD memory.
+					 * Consecutive writes go to consecutive columns,
+					 * so a page aligned run of glyphs is just a stream of writes.
 					 */
-
-					if((thielefont) && ((height - tfp) < 8))
-					{
-						fdata >>= (8 - (height & 7));
-					}
-
-					if(this->FontColor == WHITE)
-						fdata ^= 0xff;	/* inverted data for "white" color	*/
+					glcd_Device::WriteData(fdata);
+				}
+				else
+				{
+					/*
+					 * Merge the shifted font pixels into the LCD page
+					 * keeping the bits outside of the glyph.
+					 */
+					dbyte = glcd_Device::ReadData();
+					dbyte = (dbyte & ~mask) | ((fdata << dp) & mask);
+					glcd_Device::WriteData(dbyte);
 				}
-				tfp++;
-				dp++;
 			}
 
 			/*
-			 * Now flush out the painted byte.
+			 * now create a horizontal gap (vertical line of pixels) between characters.
+			 * Since this gap is "white space", the pixels painted are oposite of the
+			 * font color.
 			 */
-			glcd_Device::WriteData(dbyte);
-		}
-
-		/*
-		 * now create a horizontal gap (vertical line of pixels) between characters.
-		 * Since this gap is "white space", the pixels painted are oposite of the
-		 * font color.
-		 *
-		 * Since full LCD pages are being written, there are 4 combinations of filling
-		 * in the this gap page.
-		 *	- pixels start at bit 0 and go down less than 8 bits
-		 *	- pixels don't start at 0 but go down through bit 7
-		 *	- pixels don't start at 0 and don't go down through bit 7 (fonts shorter than 6 hi)
-		 *	- pixels start at bit 0 and go down through bit 7 (full byte)
-		 *
-		 * The code below creates a mask of the bits that should not be painted.
-		 *
-		 * Then it is easy to paint the desired bits since if the color is WHITE,
-		 * the paint bits are set, and if the coloer is not WHITE the paint bits are stripped.
-		 * and the paint bits are the inverse of the desired bits mask.
-		 */
-
-
-		
-		if((dy & 7) || (pixels - p < 8))
-		{
-		uint8_t mask = 0;
-
-			dbyte = glcd_Device::ReadData();
 
-			if(dy & 7)
-				mask |= _BV(dy & 7) -1;
-
-			if((pixels-p) < 8)
-				mask |= ~(_BV(pixels - p) -1);
-
-
-			if(this->FontColor == WHITE)
-				dbyte |= ~mask;	
+			if(mask == 0xff)
+			{
+				dbyte = 0;
+			}
 			else
-				dbyte &= mask;
-
-		}
-		else
-		{
+			{
+				dbyte = glcd_Device::ReadData() & ~mask;
+			}
 			if(this->FontColor == WHITE)
-				dbyte = 0xff;
-			else
-				dbyte = 0;
-		}
+				dbyte |= mask;
 
-		glcd_Device::WriteData(dbyte);
-
-		/*
-		 * advance the font pixel for the pixels
-		 * just painted.
-		 */
-
-		p += 8 - (dy & 7);
+			glcd_Device::WriteData(dbyte);
+		}
 	}
 
 
@@ -1081,15 +1138,128 @@ int gText::PutChar(uint8_t c)
 	 *
 	 */
 
-	this->x = this->x+width+1;
+	for(g = 0; g < count; g++)
+		this->x = this->x+glyphs[g].width+1;
 
 /*================== END of NEW FONT DRAWING ============================*/
+}
+#endif
 
-#endif // NEW_FONTDRAW
 
-	return 1; // valid char
+#ifdef GLCD_FONT_INDEX
+/*
+ * return the sum of the widths of all the glyphs before c
+ * in the current variable width font.
+ *
+ * The sums for the font are built the first time the font is used
+ * so each glyph lookup after that is a single table read.
+ * Characters beyond the end of the table continue summing from the
+ * last entry.
+ */
+uint16_t gText::GlyphIndex(uint8_t c, uint8_t charCount)
+{
+uint16_t index;
+uint8_t i;
+
+	if(this->Font != IndexFont)
+	{
+		index = 0;
+		for(i = 0; i < charCount && i < GLCD_FONT_INDEX; i++)
+		{
+			FontIndex[i] = index;
+			index += FontRead(this->Font+FONT_WIDTH_TABLE+i);
+		}
+		IndexFont = this->Font;
+	}
+
+	if(c < GLCD_FONT_INDEX)
+		return(FontIndex[c]);
+
+	i = GLCD_FONT_INDEX-1;
+	index = FontIndex[i];
+	while(i < c)
+	{
+		index += FontRead(this->Font+FONT_WIDTH_TABLE+i);
+		i++;
+	}
+	return(index);
 }
+#endif
+
+/*
+ * output len characters from str, or up to the terminating null if that is sooner
+ *
+ * str is in program memory when progmem is true.
+ *
+ * Printable characters that fit on the current text line are drawn
+ * up to GLYPH_BATCH at a time by DrawGlyphs(), which paints each LCD page
+ * across all of them in a single pass instead of revisiting every page
+ * for each character.
+ * Anything else (special characters, a character that needs a wrap,
+ * or a pending deferred scroll) goes through PutChar() one character at a time,
+ * so the text area behaves exactly as if each character was sent to PutChar().
+ */
+void gText::PutRun(const char *str, uint16_t len, uint8_t progmem)
+{
+uint8_t c;
+
+#ifdef GLCD_OLD_FONTDRAW
+	while(len-- && (c = progmem ? pgm_read_byte(str) : *str) != 0)
+	{
+		this->PutChar(c);
+		str++;
+	}
+#else
+fontInfo font;
+glyphInfo glyphs[GLYPH_BATCH];
+uint8_t count, x;
+uint16_t left;
+
+	if(this->Font)
+		this->GetFontInfo(&font);
+
+	while(len && (c = progmem ? pgm_read_byte(str) : *str) != 0)
+	{
+		count = 0;
+		left = len;
+		x = this->x;
+
+		if(this->Font && c >= 0x20
+#ifndef GLCD_NODEFER_SCROLL
+			&& !this->need_scroll
+#endif
+		)
+		{
+			while(count < GLYPH_BATCH && len && (c = progmem ? pgm_read_byte(str) : *str) >= 0x20)
+			{
+				/*
+				 * characters with no glyph are skipped, as PutChar() does
+				 */
+				if(this->FindGlyph(c, &font, &glyphs[count]))
+				{
+					if(x + glyphs[count].width > this->tarea.x2)
+						break;
+					x += glyphs[count].width+1;
+					count++;
+				}
+				str++;
+				len--;
+			}
+		}
 
+		if(count)
+		{
+			this->DrawGlyphs(&font, glyphs, count);
+		}
+		else if(len == left)
+		{
+			this->PutChar(c);
+			str++;
+			len--;
+		}
+	}
+#endif
+}
 
 /**
  * output a character string
@@ -1110,11 +1280,7 @@ int gText::PutChar(uint8_t c)
 
 void gText::Puts(char *str)
 {
-    while(*str)
-	{
-        this->PutChar((uint8_t)*str);
-        str++;
-    }
+	this->PutRun(str, 0xffff, false);
 }
 
 /**
@@ -1135,13 +1301,7 @@ void gText::Puts(char *str)
 
 void gText::Puts_P(PGM_P str)
 {
-uint8_t c;
-
-    while((c = pgm_read_byte(str)) != 0)
-	{
-        this->PutChar(c);
-        str++;
-    }
+	this->PutRun(str, 0xffff, true);
 }
 
 /**
@@ -1417,6 +1577,10 @@ void gText::EraseTextLine( uint8_t row)
 void gText::SelectFont(Font_t font,uint8_t color, FontCallback callback)
 {
 	this->Font = font;
+#ifdef GLCD_FONT_INDEX
+	if(callback != FontRead)
+		IndexFont = 0;	// font data may read differently, rebuild the glyph index
+#endif
 	FontRead = callback;  // this sets the callback that will be used by all instances of gText
 	this->FontColor = color;
 }
@@ -1616,23 +1780,315 @@ void gText::printFlashln(FLASHSTRING str)
 #ifndef GLCD_NO_PRINTF
 /*
  * Support for printf().
- * This code plays a few games with the AVR stdio routines.
  *
- * The Printf() functions fudge up a STDIO stream to point back to a C callable function
- * which recovers the C++ text area object (this) and then prints the character
- * using the C++ text area object.
+ * The format string is parsed here rather than with the avr-libc vfprintf()
+ * so no stdio stream or printf library code is needed.
+ * Literal text and each converted field go straight to PutRun(),
+ * so they are drawn a run of characters at a time with no line buffer.
+ * Only a number being converted is held, in a small buffer on the stack.
+ */
+
+#define FMT_LEFT	0x01	// '-' flag, left justify in the field
+#define FMT_ZERO	0x02	// '0' flag, pad numbers with leading zeros
+#define FMT_PLUS	0x04	// '+' flag, show a + sign on positive numbers
+#define FMT_SPACE	0x08	// ' ' flag, show a space in place of a + sign
+#define FMT_PREC	0x10	// a precision was given
+#define FMT_ALT		0x20	// '#' flag, 0 or 0x prefix on octal and hex numbers
+
+#define FMT_BUFSIZE		24	// longest converted number including sign, zeros and fraction
+#define FMT_FRACMAX		9	// most %f fraction digits, 10^9 fits in an unsigned long
+#define FMT_PREFIXMAX	2	// room left by the zero padding for a sign, 0 or 0x prefix
+
+static const char FmtSpaces[] PROGMEM = "        ";
+
+static inline uint8_t FmtRead(const char *p, uint8_t progmem)
+{
+	return(progmem ? pgm_read_byte(p) : *p);
+}
+
+/*
+ * output len characters of str in a field of width characters
+ * padded with spaces on the left, or on the right when left is true
  */
+void gText::FormatField(const char *str, uint16_t len, uint8_t progmem, uint8_t width, uint8_t left)
+{
+uint8_t pad, n;
+
+	pad = width > len ? width - len : 0;
+	if(left)
+		this->PutRun(str, len, progmem);
+	while(pad)
+	{
+		n = pad < sizeof(FmtSpaces)-1 ? pad : sizeof(FmtSpaces)-1;
+		this->PutRun(FmtSpaces, n, true);
+		pad -= n;
+	}
+	if(!left)
+		this->PutRun(str, len, progmem);
+}
 
-extern "C"
+/*
+ * output the format string with its tags replaced by the arguments in ap
+ */
+void gText::Format(const char *format, uint8_t progmem, va_list ap)
 {
-  int glcdputc(char c, FILE *fp)
-  {
-  gText *gtp;
-
-	gtp = (gText *) fdev_get_udata(fp);
-	gtp->write((uint8_t) c);
-	return(0);
-  }
+const char *start;
+char buf[FMT_BUFSIZE];
+char *p;
+uint8_t c, flags, width, prec, base, islong, digits, hexa;
+unsigned long u, frac, scale;
+char sign;
+int n;
+
+	for(;;)
+	{
+		/*
+		 * literal text up to the next tag
+		 */
+		start = format;
+		while((c = FmtRead(format, progmem)) != 0 && c != '%')
+			format++;
+		if(format != start)
+			this->PutRun(start, format - start, progmem);
+		if(c == 0)
+			return;
+		format++;
+
+		/*
+		 * flags, width, precision and length of the tag
+		 */
+		flags = 0;
+		for(;;)
+		{
+			c = FmtRead(format++, progmem);
+			if(c == '-')
+				flags |= FMT_LEFT;
+			else if(c == '0')
+				flags |= FMT_ZERO;
+			else if(c == '+')
+				flags |= FMT_PLUS;
+			else if(c == ' ')
+				flags |= FMT_SPACE;
+			else if(c == '#')
+				flags |= FMT_ALT;
+			else
+				break;
+		}
+
+		width = 0;
+		if(c == '*')
+		{
+			n = va_arg(ap, int);
+			if(n < 0)
+			{
+				flags |= FMT_LEFT;
+				n = -n;
+			}
+			width = n;
+			c = FmtRead(format++, progmem);
+		}
+		else
+		{
+			while(c >= '0' && c <= '9')
+			{
+				width = width * 10 + c - '0';
+				c = FmtRead(format++, progmem);
+			}
+		}
+
+		prec = 0;
+		if(c == '.')
+		{
+			flags |= FMT_PREC;
+			c = FmtRead(format++, progmem);
+			if(c == '*')
+			{
+				n = va_arg(ap, int);
+				if(n < 0)
+					flags &= ~FMT_PREC;
+				else
+					prec = n;
+				c = FmtRead(format++, progmem);
+			}
+			else
+			{
+				while(c >= '0' && c <= '9')
+				{
+					prec = prec * 10 + c - '0';
+					c = FmtRead(format++, progmem);
+				}
+			}
+		}
+
+		islong = 0;
+		while(c == 'l' || c == 'h')
+		{
+			if(c == 'l')
+				islong = 1;
+			c = FmtRead(format++, progmem);
+		}
+
+		/*
+		 * convert the argument
+		 * Numbers are built backwards from the end of buf.
+		 */
+		p = buf + sizeof(buf);
+		sign = 0;
+		base = 10;
+		hexa = 'a';
+		digits = 0;
+
+		switch(c)
+		{
+		  case 0:
+			return;		// format ended inside a tag
+
+		  case 's':
+		  case 'S':		// string in program memory, as with avr-libc
+			start = va_arg(ap, const char *);
+			u = c == 'S' ? strlen_P(start) : strlen(start);
+			if((flags & FMT_PREC) && u > prec)
+				u = prec;
+			this->FormatField(start, u, c == 'S', width, flags & FMT_LEFT);
+			continue;
+
+		  case 'c':
+			*--p = va_arg(ap, int);
+			this->FormatField(p, 1, false, width, flags & FMT_LEFT);
+			continue;
+
+		  case 'd':
+		  case 'i':
+			{
+			long v = islong ? va_arg(ap, long) : va_arg(ap, int);
+
+				if(v < 0)
+				{
+					sign = '-';
+					u = -(unsigned long)v;
+				}
+				else
+					u = v;
+			}
+			break;
+
+		  case 'u':
+		  case 'o':
+		  case 'x':
+		  case 'X':
+			u = islong ? va_arg(ap, unsigned long) : va_arg(ap, unsigned int);
+			if(c == 'u' || u == 0)
+				flags &= ~FMT_ALT;
+			if(c == 'o')
+				base = 8;
+			else if(c != 'u')
+				base = 16;
+			if(c == 'X')
+				hexa = 'A';
+			flags &= ~(FMT_PLUS|FMT_SPACE);
+			break;
+
+		  case 'f':
+			{
+			/*
+			 * The value is split into whole and fraction parts as unsigned longs,
+			 * so only a float to integer conversion is needed,
+			 * not the avr-libc floating point printf.
+			 * The whole part must fit in an unsigned long.
+			 */
+			double v = va_arg(ap, double);
+
+				if(!(flags & FMT_PREC))
+					prec = 6;
+				if(prec > FMT_FRACMAX)
+					prec = FMT_FRACMAX;
+				if(v < 0)
+				{
+					sign = '-';
+					v = -v;
+				}
+				for(scale = 1, n = prec; n; n--)
+					scale *= 10;
+
+				u = (unsigned long) v;
+				frac = (unsigned long) ((v - u) * scale + 0.5);
+				if(frac >= scale)	// rounded up into the whole part
+				{
+					frac -= scale;
+					u++;
+				}
+				for(n = prec; n; n--)
+				{
+					*--p = '0' + frac % 10;
+					frac /= 10;
+				}
+				if(prec)
+					*--p = '.';
+				digits = prec ? prec + 1 : 0;
+				flags &= ~FMT_PREC;	// precision was the fraction, not the minimum digits
+			}
+			break;
+
+		  default:		// %% and unknown tags output the tag character
+			*--p = c;
+			this->FormatField(p, 1, false, width, flags & FMT_LEFT);
+			continue;
+		}
+
+		/*
+		 * number digits, at least prec of them
+		 */
+		do
+		{
+			c = u % base;
+			*--p = c < 10 ? '0' + c : hexa + c - 10;
+			u /= base;
+			digits++;
+		} while(u);
+
+		if(flags & FMT_PREC)
+		{
+			while(digits < prec && p > buf + FMT_PREFIXMAX)
+			{
+				*--p = '0';
+				digits++;
+			}
+		}
+		else if((flags & FMT_ZERO) && !(flags & FMT_LEFT))
+		{
+			n = width - (sign || (flags & (FMT_PLUS|FMT_SPACE)));
+			if((flags & FMT_ALT) && base == 16)
+				n -= 2;
+			while(digits < n && p > buf + FMT_PREFIXMAX)
+			{
+				*--p = '0';
+				digits++;
+			}
+		}
+
+		/*
+		 * a 0x prefix is put in place of the sign, an octal 0 is one more digit
+		 */
+		if(flags & FMT_ALT)
+		{
+			if(base == 16)
+			{
+				*--p = hexa + 'x' - 'a';
+				sign = '0';
+			}
+			else if(base == 8 && *p != '0')
+				*--p = '0';
+		}
+
+		if(!sign && (flags & FMT_PLUS))
+			sign = '+';
+		else if(!sign && (flags & FMT_SPACE))
+			sign = ' ';
+		if(sign)
+			*--p = sign;
+
+		this->FormatField(p, buf + sizeof(buf) - p, false, width, flags & FMT_LEFT);
+	}
 }
 
 /**
@@ -1644,12 +2100,24 @@ extern "C"
  * Writes a sequence of data formatted as the @em format argument specifies.
  * After the @em format parameter, the function expects at least as many additional
  * arguments as specified in @em format.
- * The format string supports all standard @em printf() formating % tags.
+ *
+ * The format string supports these printf() % tags:
+ *	- @b %d %i %u %o %x %X integers, with an @b l length for long arguments
+ *	- @b %f floating point, the default precision is 6 digits
+ *	- @b %c a character
+ *	- @b %s a string, @b %S a string in program memory
+ *	- @b %% a percent sign
+ *
+ * The '-', '0', '+', ' ' and '#' flags, a field width and a precision are supported,
+ * the width and precision can be given with a '*'. The precision is the
+ * minimum number of digits of an integer, the number of fraction digits of
+ * a floating point number (at most 9) or the most characters of a string.
  *
  * @note
- *	By default @em printf() has no floating support in AVR enviornments.
- *	In order to enable this, a linker option must be changed. Currenly,
- *	the Arduino IDE does not support modifying the linker options.
+ *	The tags are converted by the library, not by the avr-libc printf,
+ *	so %f works without changing the linker options.
+ *	Floating point values are converted using unsigned long arithmetic
+ *	so the whole number part must be less than 4294967296.
  *
  * @see Printf_P()
  */ 
@@ -1657,15 +2125,10 @@ extern "C"
 
 void gText::Printf(const char *format, ...)
 {
-static FILE stdiostr;
-
 	va_list ap;
 
-	fdev_setup_stream(&stdiostr, glcdputc, NULL, _FDEV_SETUP_WRITE);
-	fdev_set_udata(&stdiostr, this);
-
 	va_start(ap, format);
-	vfprintf(&stdiostr, format, ap);
+	this->Format(format, false, ap);
 	va_end(ap);
 }
 
@@ -1682,15 +2145,10 @@ static FILE stdiostr;
 
 void gText::Printf_P(const char *format, ...)
 {
-static FILE stdiostr;
-
 	va_list ap;
 
-	fdev_setup_stream(&stdiostr, glcdputc, NULL, _FDEV_SETUP_WRITE);
-	fdev_set_udata(&stdiostr, this);
-
 	va_start(ap, format);
-	vfprintf_P(&stdiostr, format, ap);
+	this->Format(format, true, ap);
 	va_end(ap);
 }
 
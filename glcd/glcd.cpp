@@ -34,8 +34,6 @@
 #include "glcd.h"
 #include "glcd_Config.h" 
 
-#define BITMAP_FIX // enables a bitmap rendering fix/patch
-
 
 glcd::glcd(){
    glcd_Device::Inverted = NON_INVERTED; 
@@ -239,20 +237,76 @@ void glcd::DrawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t
 void glcd::DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color) {
   	int16_t tSwitch; 
 	uint8_t x1 = 0, y1 = radius;
+	uint8_t arc[radius+2];
   	tSwitch = 3 - 2 * radius;
+
+	/*
+	 * All four corners plot the same points, so only the highest
+	 * point of the arc in each column of a corner is kept.
+	 * RoundSpans() draws the corners and sides from that.
+	 */
+	for(uint8_t c = 0; c <= radius; c++)
+		arc[c] = 0;
 	
-	while (x1 <= y1) {
-	    this->SetDot(x+radius - x1, y+radius - y1, color);
-	    this->SetDot(x+radius - y1, y+radius - x1, color);
+	while (x1 <= y1 && y1 <= radius) {	// y1 wraps when radius is 0
+		if(y1 > arc[x1])
+			arc[x1] = y1;
+		if(x1 > arc[y1])
+			arc[y1] = x1;
 
-	    this->SetDot(x+width-radius + x1, y+radius - y1, color);
-	    this->SetDot(x+width-radius + y1, y+radius - x1, color);
-	    
-	    this->SetDot(x+width-radius + x1, y+height-radius + y1, color);
-	    this->SetDot(x+width-radius + y1, y+height-radius + x1, color);
+	    if (tSwitch < 0) {
+	    	tSwitch += (4 * x1 + 6);
+	    } else {
+	    	tSwitch += (4 * (x1 - y1) + 10);
+	    	y1--;
+	    }
+	    x1++;
+	}
 
-	    this->SetDot(x+radius - x1, y+height-radius + y1, color);
-	    this->SetDot(x+radius - y1, y+height-radius + x1, color);
+	this->RoundSpans(x, y, width, height, radius, arc, false, color);
+}
+
+/**
+ * Fill a rectangle with rounded corners
+ *
+ * @param x the x coordinate of the upper left corner of the rectangle
+ * @param y the y coordinate of the upper left corner of the rectangle
+ * @param width width of the rectangle
+ * @param height height of the rectangle
+ * @param radius radius of the corners
+ * @param color BLACK or WHITE
+ *
+ * Fills the area inside a rectangle drawn by DrawRoundRect() with the same
+ * arguments, including the outline.
+ * The radius is limited to half the width and height.
+ *
+ * Color is optional and defaults to BLACK.
+ *
+ * @see DrawRoundRect()
+ * @see FillRect()
+ */
+
+void glcd::FillRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color) {
+  	int16_t tSwitch; 
+	uint8_t x1 = 0, y1;
+
+	if(radius > width/2)
+		radius = width/2;
+	if(radius > height/2)
+		radius = height/2;
+
+	uint8_t arc[radius+2];
+
+	y1 = radius;
+  	tSwitch = 3 - 2 * radius;
+	for(uint8_t c = 0; c <= radius; c++)
+		arc[c] = 0;
+	
+	while (x1 <= y1 && y1 <= radius) {	// y1 wraps when radius is 0
+		if(y1 > arc[x1])
+			arc[x1] = y1;
+		if(x1 > arc[y1])
+			arc[y1] = x1;
 
 	    if (tSwitch < 0) {
 	    	tSwitch += (4 * x1 + 6);
@@ -262,11 +316,150 @@ void glcd::DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, ui
 	    }
 	    x1++;
 	}
-	  	
-	this->DrawHLine(x+radius, y, width-(2*radius), color);			// top
-	this->DrawHLine(x+radius, y+height, width-(2*radius), color);	// bottom
-	this->DrawVLine(x, y+radius, height-(2*radius), color);			// left
-	this->DrawVLine(x+width, y+radius, height-(2*radius), color);	// right
+
+	this->RoundSpans(x, y, width, height, radius, arc, true, color);
+}
+
+/*
+ * return the bits of the LCD page byte for rows y to y+7
+ * that are in the vertical run of len pixels starting at row start.
+ *
+ * Rows wrap at 256, the same as the uint8_t coordinates
+ * passed to SetDot(), so runs that start above the display
+ * are clipped rather than wrapping to the bottom.
+ */
+static uint8_t RunMask(uint8_t y, uint8_t start, uint16_t len)
+{
+uint8_t d;
+
+	d = y - start;		/* rows from start of run to top of page */
+	if(d < len)
+	{
+		len -= d;
+		return(len >= 8 ? 0xff : _BV(len)-1);
+	}
+
+	d = start - y;		/* rows from top of page to start of run */
+	if(d < 8)
+		return((len >= 8 ? 0xff : _BV(len)-1) << d);
+
+	return(0);
+}
+
+/*
+ * draw a rectangle with rounded corners one LCD page at a time
+ *
+ * arc[c] is the highest point of a corner arc (distance above the corner center)
+ * in column c, counting out from the center column of the corner.
+ * The arc is contiguous so the lowest point in column c is just above
+ * the highest point in column c+1.
+ *
+ * The spans for all the corners, edges and sides that touch an LCD page
+ * byte are merged into one mask, so each byte is read and written once
+ * and the bytes of a page are written in column order.
+ * Bytes that are completely covered are written without a read.
+ *
+ * When fill is true, every column is filled from the top to the bottom
+ * of the shape instead.
+ */
+
+void glcd::RoundSpans(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t *arc, uint8_t fill, uint8_t color)
+{
+int16_t off, left, right, above;
+int16_t edge = width - radius;	/* offset of the center column of the right corners */
+uint8_t page, col, mask, data, c, lo;
+
+	/*
+	 * The corners can reach past the sides when the radius is larger than
+	 * half the width or height.
+	 */
+	left = edge < 0 ? edge : 0;
+	right = width > radius ? width : radius;
+
+	above = height < radius ? height - radius : 0;
+	uint8_t top = y + above;
+	uint16_t rows = (height > radius ? height : radius) - above + 1;
+
+	arc[radius+1] = -1;		/* so the lowest point in the last column is 0 */
+
+	for(page = 0; page < DISPLAY_HEIGHT; page += 8)
+	{
+		if(RunMask(page, top, rows) == 0)
+			continue;
+
+		for(off = left; off <= right; off++)
+		{
+			col = x + off;
+			if(col >= DISPLAY_WIDTH)
+				continue;
+
+			mask = 0;
+			for(uint8_t corner = 0; corner < 2; corner++)
+			{
+				if(corner == 0 && off >= 0 && off <= radius)
+					c = radius - off;	/* left corners */
+				else if(corner == 1 && off >= edge && off <= width)
+					c = off - edge;		/* right corners */
+				else
+					continue;
+
+				if(fill)
+				{
+					mask |= RunMask(page, y+radius-arc[c], height - 2*radius + 2*arc[c] + 1);
+				}
+				else
+				{
+					lo = arc[c+1]+1;
+					if(lo > arc[c])
+						lo = arc[c];
+					mask |= RunMask(page, y+radius-arc[c], arc[c]-lo+1);
+					mask |= RunMask(page, y+height-radius+lo, arc[c]-lo+1);
+				}
+			}
+
+			if(off >= radius && off <= edge)
+			{
+				/*
+				 * top and bottom edges
+				 */
+				if(fill)
+				{
+					mask |= RunMask(page, y, height+1);
+				}
+				else
+				{
+					mask |= RunMask(page, y, 1);
+					mask |= RunMask(page, y+height, 1);
+				}
+			}
+
+			if(!fill && (off == 0 || off == width) && height >= 2*radius)
+			{
+				/*
+				 * left and right sides
+				 */
+				mask |= RunMask(page, y+radius, height - 2*radius + 1);
+			}
+
+			if(mask == 0)
+				continue;
+
+			glcd_Device::GotoXY(col, page);
+			if(mask == 0xff)
+			{
+				data = color;
+			}
+			else
+			{
+				data = this->ReadData();
+				if(color == BLACK)
+					data |= mask;
+				else
+					data &= ~mask;
+			}
+			this->WriteData(data);
+		}
+	}
 }
 
 /**
@@ -414,56 +607,169 @@ void glcd::SetDisplayMode(uint8_t invert) {  // was named SetInverted
  *
  * Draws a bitmap image with the upper left corner at location x,y
  * The bitmap data is assumed to be in program memory.
+ * Bitmaps that glcdMakeBitmap compressed are decoded as they are drawn.
  *
  * Color is optional and defaults to BLACK.
  *
+ * The pixels drawn are exactly those of the bitmap, at any y location
+ * and for any height, and the parts of the bitmap off the display are clipped.
+ *
+ * @see BlitBitmap()
  */
 
 void glcd::DrawBitmap(Image_t bitmap, uint8_t x, uint8_t y, uint8_t color){
-uint8_t width, height;
-uint8_t i, j;
-
-  width = ReadPgmData(bitmap++); 
-  height = ReadPgmData(bitmap++);
-
-#ifdef BITMAP_FIX // temporary ifdef just to show what changes if a new 
-				// bit rendering routine is written.
-							
-  /*
-   * In the absence of a new/better/proper bitmap rendering routine,
-   * this routine will provide a temporary fix for drawing bitmaps that are
-   * are non multiples of 8 pixels in height and start on non LCD page Y addresses.
-   *
-   * Note: nomally a routine like this should not have knowledge of how
-   *	   how the lower level write routine works. But in this case it does.
-   *
-   *	Currently, the low level WriteData() routine ORs in the pixels when data spans
-   *	a LCD memory page. So.....
-   *
-   * In order to ensure that the bitmap data is written to the pixels *exactly* as it
-   * it defined in the bitmap data, i.e every black pixels is black and every white
-   * pixel is white,...
-   *
-   * If height or y coordinate is not on a page boundary, clear the background first
-   *	Techincally, this could be done all the time and it wouldn't hurt, it
-   *	would just suck up a few more cycles.
-   */
-  if( (y & 7) || (height & 7))
-  {
-  	this->FillRect(x, y, width, height, WHITE);
-  }
-#endif
+	this->BlitBitmap(bitmap, x, y, 0, 0, 0xff, 0xff, BLIT_OPAQUE, color);
+}
+
+/**
+ * Draw part of a bitmap image
+ *
+ * @param bitmap a ponter to the bitmap data
+ * @param x the x coordinate on the display for the left of the bitmap area, can be negative
+ * @param y the y coordinate on the display for the top of the bitmap area, can be negative
+ * @param sx the x coordinate in the bitmap of the left of the area drawn
+ * @param sy the y coordinate in the bitmap of the top of the area drawn
+ * @param width the width of the area drawn, it is limited to the bitmap width
+ * @param height the height of the area drawn, it is limited to the bitmap height
+ * @param rop @b BLIT_OPAQUE, @b BLIT_TRANSPARENT or @b BLIT_XOR
+ * @param color BLACK or WHITE
+ *
+ * Draws the width by height area of the bitmap at sx,sy with its upper left corner
+ * at location x,y. Any part of the area off the display is clipped, so
+ * sprites can move smoothly on and off the edges of the display.
+ *
+ * The raster operation selects how bitmap pixels are combined with the display:
+ * - BLIT_OPAQUE: set bitmap pixels are drawn in color and clear ones in the other color
+ * - BLIT_TRANSPARENT: only set bitmap pixels are drawn, in color
+ * - BLIT_XOR: set bitmap pixels invert the display pixels, color is not used
+ *
+ * Each display byte touched is written once. It is only read when it is not
+ * completely covered by an opaque bitmap, and with GLCD_SHADOW_BUFFER that
+ * read is from RAM.
+ *
+ * @see DrawBitmap()
+ */
+
+void glcd::BlitBitmap(Image_t bitmap, int16_t x, int16_t y, uint8_t sx, uint8_t sy, 
+	uint8_t width, uint8_t height, uint8_t rop, uint8_t color)
+{
+uint8_t bwidth, bheight, bpages;
+uint8_t rle;
+uint8_t page, lastpage, mask, b, i;
+uint8_t lo, hi, bits, data;
+int16_t srow, sp;
+int16_t rspage;
+Image_t src;
+rleStream rs, rlo, rhi;
+
+	bwidth = ReadPgmData(bitmap++);
+	bheight = ReadPgmData(bitmap++);
+	rle = bheight & BITMAP_RLE;
+	bheight &= ~BITMAP_RLE;
+	bpages = (bheight + 7)/8;
+
+	/*
+	 * Clip the area to the bitmap and then to the display
+	 */
+	if(sx >= bwidth || sy >= bheight)
+		return;
+	if(width > bwidth - sx)
+		width = bwidth - sx;
+	if(height > bheight - sy)
+		height = bheight - sy;
+
+	if(x < 0)
+	{
+		if(-x >= width)
+			return;
+		sx -= x;
+		width += x;
+		x = 0;
+	}
+	if(y < 0)
+	{
+		if(-y >= height)
+			return;
+		sy -= y;
+		height += y;
+		y = 0;
+	}
+	if(x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+		return;
+	if(x + width > DISPLAY_WIDTH)
+		width = DISPLAY_WIDTH - x;
+	if(y + height > DISPLAY_HEIGHT)
+		height = DISPLAY_HEIGHT - y;
+
+	/*
+	 * The display byte for LCD page "page" holds bitmap rows srow to srow+7,
+	 * which are the two bitmap page bytes starting at page sp shifted by b.
+	 * Compressed bitmaps are decoded from the start of bitmap page rspage.
+	 */
+	RleStart(&rs, bitmap, ReadPgmData);
+	rspage = 0;
+
+	lastpage = (y + height - 1)/8;
+	for(page = y/8; page <= lastpage; page++)
+	{
+		mask = 0xff;
+		if(page == y/8)
+			mask <<= y & 7;
+		if(page == lastpage)
+			mask &= 0xff >> (7 - ((y + height - 1) & 7));
+
+		srow = sy + page*8 - y;
+		sp = srow >> 3;
+		b = srow & 7;
+
+		if(rle)
+		{
+			if(sp > rspage)
+			{
+				RleSkip(&rs, (uint16_t)(sp - rspage) * bwidth);
+				rspage = sp;
+			}
+			rlo = rs;
+			RleSkip(&rlo, sx);
+			if(b && sp+1 < bpages)
+			{
+				rhi = rs;
+				RleSkip(&rhi, (sp < 0 ? 0 : bwidth) + sx);
+			}
+		}
+		src = bitmap + sp*bwidth + sx;
 
-  for(j = 0; j < height / 8; j++) {
-     glcd_Device::GotoXY(x, y + (j*8) );
-	 for(i = 0; i < width; i++) {
-		 uint8_t displayData = ReadPgmData(bitmap++);
-	   	 if(color == BLACK)
-			this->WriteData(displayData);
-		 else
-		    this->WriteData(~displayData);
-	 }
-  }
+		glcd_Device::GotoXY(x, page*8);
+		for(i = 0; i < width; i++)
+		{
+			lo = 0;
+			hi = 0;
+			if(sp >= 0)
+				lo = rle ? RleRead(&rlo) : ReadPgmData(src + i);
+			if(b && sp+1 < bpages)
+				hi = rle ? RleRead(&rhi) : ReadPgmData(src + bwidth + i);
+			bits = ((lo >> b) | (hi << (8 - b))) & mask;
+
+			if(rop == BLIT_OPAQUE && mask == 0xff)
+			{
+				/*
+				 * whole display byte is replaced, no need to read it
+				 */
+				data = color == BLACK ? bits : ~bits;
+			}
+			else
+			{
+				data = glcd_Device::ReadData();
+				if(rop == BLIT_XOR)
+					data ^= bits;
+				else if(rop == BLIT_TRANSPARENT)
+					data = color == BLACK ? data | bits : data & ~bits;
+				else
+					data = (data & ~mask) | ((color == BLACK ? bits : ~bits) & mask);
+			}
+			glcd_Device::WriteData(data);
+		}
+	}
 }
 // the following inline functions were added 2 Dec 2009 to replace macros
 
@@ -585,6 +891,9 @@ void glcd::FillCircle(uint8_t x0, uint8_t y0, uint8_t radius, uint8_t color)
  *		For now, it is limited to circles.
  *
  * 			--- bperrybap
+ *
+ *	FillRoundRect() now fills rounded rectangles using the same column
+ *	spans as this routine.
  */
 
 int f = 1 - radius;
@@ -592,11 +901,18 @@ int ddF_x = 1;
 int ddF_y = -2 * radius;
 uint8_t x = 0;
 uint8_t y = radius;
+uint8_t arc[radius+2];
  
 	/*
-	 * Fill in the center between the two halves
+	 * Rather than drawing the vertical lines between the points on the circle,
+	 * keep the length of the longest line in each column,
+	 * RoundSpans() then fills the columns one LCD page at a time.
+	 *
+	 * The center column is the full diameter.
 	 */
-	DrawLine(x0, y0-radius, x0, y0+radius, color);
+	for(uint8_t c = 0; c <= radius; c++)
+		arc[c] = 0;
+	arc[0] = radius;
  
 	while(x < y)
 	{
@@ -614,16 +930,17 @@ uint8_t y = radius;
 		f += ddF_x;    
 
 		/*
-		 * Now draw vertical lines between the points on the circle rather than
-		 * draw the points of the circle. This draws lines between the 
-		 * perimeter points on the upper and lower quadrants of the 2 halves of the circle.
+		 * The lines between the perimeter points on the upper and lower quadrants
+		 * of the 2 halves of the circle are at x0+/-x and x0+/-y.
 		 */
 
-		DrawLine(x0+x, y0+y, x0+x, y0-y, color);
-		DrawLine(x0-x, y0+y, x0-x, y0-y, color);
-		DrawLine(x0+y, y0+x, y+x0, y0-x, color);
-		DrawLine(x0-y, y0+x, x0-y, y0-x, color);
+		if(y > arc[x])
+			arc[x] = y;
+		if(x > arc[y])
+			arc[y] = x;
   	}
+
+	this->RoundSpans(x0-radius, y0-radius, 2*radius, 2*radius, radius, arc, true, color);
 }
 
 	
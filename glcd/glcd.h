@@ -46,7 +46,15 @@ typedef const uint8_t* Image_t;
 
 // the first two bytes of bitmap data are the width and height
 #define bitmapWidth(bitmap)  (*bitmap)  
-#define bitmapHeight(bitmap)  (*(bitmap+1))  
+#define bitmapHeight(bitmap)  (*(bitmap+1) & ~BITMAP_RLE)  
+
+// height flag for bitmap data that is run length encoded (see glcd_rle.h)
+#define BITMAP_RLE	0x80
+
+// raster operations for BlitBitmap()
+#define BLIT_OPAQUE			0	// set bitmap pixels are color, clear ones are the other color
+#define BLIT_TRANSPARENT	1	// only set bitmap pixels are drawn
+#define BLIT_XOR			2	// set bitmap pixels invert the display
 
 
 /**
@@ -57,6 +65,7 @@ class glcd : public gText
 {
   private:
 	void write(uint8_t c);  // character output for print base class
+	void RoundSpans(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t *arc, uint8_t fill, uint8_t color);
   public:
 	glcd();
 	
@@ -67,6 +76,13 @@ class glcd : public gText
 	// Control functions
 	void Init(uint8_t invert = NON_INVERTED);
 	void SetDisplayMode(uint8_t mode); //NON_INVERTED or INVERTED,   was SetInverted(uint8_t invert);
+#ifdef DOXYGEN
+	void SetUpdateMode(uint8_t mode); // UPDATE_IMMEDIATE or UPDATE_DEFERRED
+	void Update(void);
+#else
+	using glcd_Device::SetUpdateMode;
+	using glcd_Device::Update;
+#endif
 /*@}*/
 	
 /** @name DRAWING FUNCTIONS
@@ -81,10 +97,13 @@ class glcd : public gText
 	void DrawRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color= BLACK);
 	void DrawRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color= BLACK);
 	void FillRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t color= BLACK);
+	void FillRoundRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height, uint8_t radius, uint8_t color= BLACK);
 	void InvertRect(uint8_t x, uint8_t y, uint8_t width, uint8_t height);
 	void DrawCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color= BLACK);	
 	void FillCircle(uint8_t xCenter, uint8_t yCenter, uint8_t radius, uint8_t color= BLACK);	
 	void DrawBitmap(Image_t bitmap, uint8_t x, uint8_t y, uint8_t color= BLACK);
+	void BlitBitmap(Image_t bitmap, int16_t x, int16_t y, uint8_t sx, uint8_t sy, uint8_t width, uint8_t height,
+		uint8_t rop = BLIT_OPAQUE, uint8_t color= BLACK);
 
 #ifdef DOXYGEN
 	/*
@@ -95,11 +114,15 @@ class glcd : public gText
 	void SetPixels(uint8_t x, uint8_t y,uint8_t x1, uint8_t y1, uint8_t color);
 	uint8_t ReadData(void);        // now public
     void WriteData(uint8_t data); 
+	void WriteSpan(uint8_t x, uint8_t y, uint8_t count, const uint8_t *data);
+	void FillSpan(uint8_t x, uint8_t y, uint8_t count, uint8_t value);
 #else
 	using glcd_Device::SetDot;
 	using glcd_Device::SetPixels;
 	using glcd_Device::ReadData; 
 	using glcd_Device::WriteData; 
+	using glcd_Device::WriteSpan; 
+	using glcd_Device::FillSpan; 
 #endif
 
 
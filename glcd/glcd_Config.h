@@ -69,8 +69,12 @@
  /*
   * autoconfig includes - (comment this out if using manual configurations, see below)
   */
+#if defined(GLCD_SIM)
+#include "config/sim_Panel.h"             // host builds (tests and benchmarks) use an in memory panel model
+#else
 #include "config/ks0108_Panel.h"          // automatically configure library for a ks0108 panel
 //#include "config/ks0108-192x64_Panel.h"   // automatically configure library for a ks0108 192x64 panel
+#endif
 
 /*
  * If you want to explicitly select a manual configuration, you can edit the desired manual configuration
@@ -107,4 +111,29 @@
 //#define GLCD_NODEFER_SCROLL    // uncomment to disable deferred newline processing
 
 
+//#define GLCD_FONT_INDEX 96    // keep a table of glyph data offsets for variable width fonts (2 bytes RAM per character)
+                                // Without it, locating a glyph adds up the widths of all the characters before it.
+                                // With it, the table is built once when a font is first used
+                                // and locating any of the first GLCD_FONT_INDEX characters is a single lookup.
+
+
+//#define GLCD_SHADOW_BUFFER    // keep a copy of display memory in RAM (DISPLAY_WIDTH * DISPLAY_HEIGHT/8 bytes)
+                                // All reads are done from RAM and only writes are sent to the glcd,
+                                // which makes every read-modify-write operation about twice as fast.
+                                // This uses 1024 bytes of RAM on a 128x64 panel.
+                                // It also enables GLCD.SetUpdateMode(UPDATE_DEFERRED) where drawing
+                                // only updates RAM and GLCD.Update() sends just the changed columns.
+
+//#define GLCD_HW_SCROLL        // scroll full display text areas a whole page at a time by moving the display start line
+                                // Only the new text line is drawn, instead of reading and rewriting the whole display.
+                                // Needs a ks0108 style controller whose memory height matches the panel height.
+                                // Scrolls by other amounts, of other areas, or in deferred update mode
+                                // are still done in display memory.
+
+//#define GLCD_BUSY_CALIBRATE   // measure how long the glcd stays busy after a data write when it is initialized
+                                // If the panel is always ready by the time the next byte can be sent,
+                                // the busy flag is not polled between the bytes of a run written to one chip,
+                                // only before the first one. Slower panels keep polling before every byte.
+
+
 #endif
@@ -29,6 +29,9 @@
 
 #include "include/glcd_Device.h"
 #include "include/glcd_io.h"
+#ifdef GLCD_HW_SCROLL
+#include <string.h>
+#endif
 
 /*
  * define the static variables declared in glcd_Device
@@ -36,6 +39,18 @@
 
 uint8_t	 glcd_Device::Inverted; 
 lcdCoord  glcd_Device::Coord;
+#ifdef GLCD_SHADOW_BUFFER
+uint8_t  glcd_Device::Shadow[(DISPLAY_HEIGHT+7)/8][DISPLAY_WIDTH];
+uint8_t  glcd_Device::Deferred;
+uint8_t  glcd_Device::DirtyX1[(DISPLAY_HEIGHT+7)/8];
+uint8_t  glcd_Device::DirtyX2[(DISPLAY_HEIGHT+7)/8];
+#endif
+#ifdef GLCD_HW_SCROLL
+uint8_t  glcd_Device::StartPage;
+#endif
+#ifdef GLCD_BUSY_CALIBRATE
+uint8_t  glcd_Device::BusyPolls;
+#endif
 
 /*
  * Experimental defines
@@ -169,27 +184,30 @@ uint8_t width = x2-x+1;
 	}
 	mask <<= pageOffset;
 	
-	this->GotoXY(x, y);
-	for(i=0; i < width; i++) {
-		data = this->ReadData();
+	if(mask == 0xFF) {
+		/*
+		 * whole first page is set, no need to read it
+		 */
+		this->FillSpan(x, y, width, color);
+	} else {
+		this->GotoXY(x, y);
+		for(i=0; i < width; i++) {
+			data = this->ReadData();
 		
-		if(color == BLACK) {
-			data |= mask;
-		} else {
-			data &= ~mask;
-		}
+			if(color == BLACK) {
+				data |= mask;
+			} else {
+				data &= ~mask;
+			}
 
-		this->WriteData(data);
+			this->WriteData(data);
+		}
 	}
 	
 	while(h+8 <= height) {
 		h += 8;
 		y += 8;
-		this->GotoXY(x, y);
-		
-		for(i=0; i <width; i++) {
-			this->WriteData(color);
-		}
+		this->FillSpan(x, y, width, color);
 	}
 	
 	if(h < height) {
@@ -236,11 +254,25 @@ void glcd_Device::GotoXY(uint8_t x, uint8_t y)
   this->Coord.x = x;								// save new coordinates
   this->Coord.y = y;
 
+#ifdef GLCD_SHADOW_BUFFER
+	if(this->Deferred)
+		return;		// h/w is positioned by Update()
+#endif
+
   chip = glcd_DevXYval2Chip(x, y);
 
-	if(y/8 != this->Coord.chip[chip].page)
+#ifdef GLCD_HW_SCROLL
+	/*
+	 * The display start line moves glcd memory pages up and down the display
+	 * so the page for y depends on which page is at the top.
+	 */
+	cmd = (y/8 + this->StartPage) % (DISPLAY_HEIGHT/8);
+#else
+	cmd = y/8;
+#endif
+	if(cmd != this->Coord.chip[chip].page)
 	{
-  		this->Coord.chip[chip].page = y/8;
+  		this->Coord.chip[chip].page = cmd;
 		cmd = LCD_SET_PAGE | this->Coord.chip[chip].page;
 	   	this->WriteCommand(cmd, chip);	
 	}
@@ -357,10 +389,27 @@ void glcd_Device::Init(uint8_t invert)
 	lcdfastWrite(glcdDI, LOW);
 	lcdfastWrite(glcdRW, LOW);
 
+#ifdef GLCD_SHADOW_BUFFER
+	/*
+	 * The clear below is always sent to the glcd,
+	 * any deferred update mode is restored at the end.
+	 */
+	uint8_t deferred = this->Deferred;
+	this->Deferred = UPDATE_IMMEDIATE;
+	for(uint8_t page = 0; page < (DISPLAY_HEIGHT+7)/8; page++)
+	{
+		this->DirtyX1[page] = 0xff;
+		this->DirtyX2[page] = 0;
+	}
+#endif
+
 	this->Coord.x = 0;
 	this->Coord.y = 0;
 	
 	this->Inverted = invert;
+#ifdef GLCD_HW_SCROLL
+	this->StartPage = 0;
+#endif
 
 	/*
 	 * Reset the glcd module if there is a reset pin defined
@@ -408,6 +457,10 @@ void glcd_Device::Init(uint8_t invert)
 
 	}
 
+#ifdef GLCD_BUSY_CALIBRATE
+	this->CalibrateBusy();
+#endif
+
 	/*
 	 * All hardware initialization is complete.
 	 *
@@ -423,6 +476,9 @@ void glcd_Device::Init(uint8_t invert)
 
 	this->SetPixels(0,0, DISPLAY_WIDTH-1,DISPLAY_HEIGHT-1, WHITE);
 	this->GotoXY(0,0);
+#ifdef GLCD_SHADOW_BUFFER
+	this->Deferred = deferred;
+#endif
 }
 
 #ifdef glcd_CHIP0  // if at least one chip select string
@@ -480,6 +536,55 @@ void glcd_Device::WaitReset( uint8_t chip)
 }
 #endif
 
+#ifdef GLCD_BUSY_CALIBRATE
+#define BUSY_CALIBRATE_WRITES	16	// data writes measured on each chip
+
+/*
+ * measure how long each chip stays busy after a data write
+ *
+ * A status read is started straight after each of a number of data writes
+ * and the polls that return busy are counted. BusyPolls is set to the most seen.
+ *
+ * When it is zero, every chip was already ready the first time the status could be read,
+ * so DoWriteSpan() streams the rest of a run to a chip without polling.
+ * Each unpolled write waits GLCD_tDDR instead, so it is never started sooner
+ * after the previous one than the status read that found the chip ready.
+ *
+ * The bytes written here are overwritten by the clear at the end of Init().
+ */
+void glcd_Device::CalibrateBusy(void)
+{
+uint8_t chip, i, polls;
+
+	this->BusyPolls = 0;
+	for(chip = 0; chip < glcd_CHIP_COUNT; chip++)
+	{
+		this->GotoXY(chip * (DISPLAY_WIDTH / glcd_CHIP_COUNT), 0);
+		for(i = 0; i < BUSY_CALIBRATE_WRITES; i++)
+		{
+			this->DoWriteData(0, chip);
+
+			lcdDataDir(0x00);
+			lcdfastWrite(glcdDI, LOW);	
+			lcdfastWrite(glcdRW, HIGH);	
+			glcd_DevENstrobeHi(chip);
+			lcdDelayNanoseconds(GLCD_tDDR);
+
+			polls = 0;
+			while(lcdIsBusy() && polls < 255)
+			{
+				polls++;
+			}
+			glcd_DevENstrobeLo(chip);
+
+			if(polls > this->BusyPolls)
+				this->BusyPolls = polls;
+		}
+	}
+	this->Coord.x = -1;	// the column address has moved, force a set column on GotoXY
+}
+#endif
+
 
 /*
  * read a single data byte from chip
@@ -516,10 +621,13 @@ uint8_t glcd_Device::DoReadData()
  *	Code can call ReadData() modify the data then
  *  call WriteData() and update the same location.
  *
+ * @note When GLCD_SHADOW_BUFFER is defined the data comes from
+ *	the RAM copy of display memory and the glcd is not accessed.
+ *
  * @see WriteData()
  */
 
-inline uint8_t glcd_Device::ReadData()
+uint8_t glcd_Device::ReadData()
 {  
 uint8_t x, data;
 
@@ -530,6 +638,20 @@ uint8_t x, data;
 		return(0);
 	}
 
+#ifdef GLCD_SHADOW_BUFFER
+	/*
+	 * The shadow copy holds exactly what is in glcd memory
+	 * and the h/w column address is not disturbed
+	 * so there is no need for a GotoXY() afterwards.
+	 */
+	data = this->Shadow[this->Coord.y/8][x];
+	if(this->Inverted)
+	{
+		data = ~data;
+	}
+	return(data);
+#else
+
 	this->DoReadData();				// dummy read
 
 	data = this->DoReadData();			// "real" read
@@ -543,6 +665,7 @@ uint8_t x, data;
 
 	this->GotoXY(x, this->Coord.y);	
 	return(data);
+#endif
 }
 
 void glcd_Device::WriteCommand(uint8_t cmd, uint8_t chip)
@@ -604,12 +727,6 @@ void glcd_Device::WriteData(uint8_t data) {
 	if(yOffset != 0) {
 		// first page
 		displayData = this->ReadData();
-		this->WaitReady(chip);
-   	    lcdfastWrite(glcdDI, HIGH);				// D/I = 1
-	    lcdfastWrite(glcdRW, LOW);				// R/W = 0
-		lcdDataDir(0xFF);						// data port is output
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
 		
 #ifdef TRUE_WRITE
 		/*
@@ -623,9 +740,7 @@ void glcd_Device::WriteData(uint8_t data) {
 		if(this->Inverted){
 			displayData = ~displayData;
 		}
-		lcdDataOut( displayData);					// write data
-		lcdDelayNanoseconds(GLCD_tWH);
-		glcd_DevENstrobeLo(chip);
+		this->DoWriteData(displayData, chip);
 
 		// second page
 
@@ -636,20 +751,13 @@ void glcd_Device::WriteData(uint8_t data) {
 		uint8_t ysave = this->Coord.y;
 		if(((ysave+8) & ~7) >= DISPLAY_HEIGHT)
 		{
-			this->GotoXY(this->Coord.x+1, ysave);
+			this->NextColumn(ysave);
 			return;
 		}
 	
 		this->GotoXY(this->Coord.x, ((ysave+8) & ~7));
 
 		displayData = this->ReadData();
-		this->WaitReady(chip);
-
-   	    lcdfastWrite(glcdDI, HIGH);					// D/I = 1
-	    lcdfastWrite(glcdRW, LOW); 					// R/W = 0	
-		lcdDataDir(0xFF);				// data port is output
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
 
 #ifdef TRUE_WRITE
 		/*
@@ -662,30 +770,14 @@ void glcd_Device::WriteData(uint8_t data) {
 		if(this->Inverted){
 			displayData = ~displayData;
 		}
-		lcdDataOut(displayData);		// write data
-		lcdDelayNanoseconds(GLCD_tWH);
-		glcd_DevENstrobeLo(chip);
-		this->GotoXY(this->Coord.x+1, ysave);
+		this->DoWriteData(displayData, chip);
+		this->NextColumn(ysave);
 	}else 
 	{
-    	this->WaitReady(chip);
-
-		lcdfastWrite(glcdDI, HIGH);				// D/I = 1
-		lcdfastWrite(glcdRW, LOW);  				// R/W = 0	
-		lcdDataDir(0xFF);						// data port is output
-
 		// just this code gets executed if the write is on a single page
 		if(this->Inverted)
 			data = ~data;	  
-
-		lcdDelayNanoseconds(GLCD_tAS);
-		glcd_DevENstrobeHi(chip);
-	
-		lcdDataOut(data);				// write data
-
-		lcdDelayNanoseconds(GLCD_tWH);
-
-		glcd_DevENstrobeLo(chip);
+		this->DoWriteData(data, chip);
 
 		/*
 		 * NOTE/WARNING:
@@ -707,10 +799,6 @@ void glcd_Device::WriteData(uint8_t data) {
 		 */
 
 		this->Coord.x++;
-#ifdef GLCD_XCOL_SUPPORT
-		this->Coord.chip[chip].col++;
-#endif
-
 
 		/*
 		 * Check for crossing into the next chip.
@@ -728,6 +816,377 @@ void glcd_Device::WriteData(uint8_t data) {
 	}
 }
 
+/*
+ * write a single data byte to chip at the current x,y
+ * Any inversion has already been done and the x,y is not advanced.
+ *
+ * In deferred update mode the byte only goes to the shadow buffer
+ * and its column is added to the dirty span of the page.
+ */
+void glcd_Device::DoWriteData(uint8_t data, uint8_t chip, uint8_t wait)
+{
+#ifdef GLCD_SHADOW_BUFFER
+	uint8_t x = this->Coord.x;
+	uint8_t page = this->Coord.y/8;
+
+	this->Shadow[page][x] = data;
+	if(this->Deferred)
+	{
+		if(x < this->DirtyX1[page])
+			this->DirtyX1[page] = x;
+		if(x > this->DirtyX2[page])
+			this->DirtyX2[page] = x;
+		return;
+	}
+#endif
+	if(wait)
+		this->WaitReady(chip);
+	else
+		lcdDelayNanoseconds(GLCD_tDDR);	// chip is already selected, see CalibrateBusy()
+
+	lcdfastWrite(glcdDI, HIGH);				// D/I = 1
+	lcdfastWrite(glcdRW, LOW);  				// R/W = 0	
+	lcdDataDir(0xFF);						// data port is output
+
+	lcdDelayNanoseconds(GLCD_tAS);
+	glcd_DevENstrobeHi(chip);
+
+	lcdDataOut(data);				// write data
+
+	lcdDelayNanoseconds(GLCD_tWH);
+
+	glcd_DevENstrobeLo(chip);
+#ifdef GLCD_XCOL_SUPPORT
+	this->Coord.chip[chip].col++;
+#endif
+}
+
+/*
+ * write a horizontal run of bytes to the LCD page at x,y
+ *
+ * The bytes come from data or, when data is 0, are all fill.
+ * Each byte is exclusive ORed with flip before it is written.
+ *
+ * The run is split at chip boundaries once, and each piece is positioned with
+ * a single GotoXY() and then streamed using the column auto-increment of the chip.
+ * There is no per byte chip lookup, x,y bookkeeping or chip crossing test
+ * as there is with WriteData().
+ * With GLCD_BUSY_CALIBRATE, a panel that is fast enough is only polled
+ * for busy before the first byte of each piece.
+ *
+ * Like WriteData(), the x location is left just past the run.
+ */
+void glcd_Device::DoWriteSpan(uint8_t x, uint8_t y, uint8_t count, const uint8_t *data, uint8_t fill, uint8_t flip)
+{
+uint8_t chip, n, wait;
+
+	if(x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+		return;
+	if(count > DISPLAY_WIDTH - x)
+		count = DISPLAY_WIDTH - x;
+	y &= ~7;
+
+	while(count)
+	{
+		chip = glcd_DevXYval2Chip(x, y);
+#ifdef CHIP_WIDTH
+		n = CHIP_WIDTH - glcd_DevXval2ChipCol(x);
+		if(n > count)
+#endif
+			n = count;
+		count -= n;
+
+		this->GotoXY(x, y);
+		wait = true;
+		do
+		{
+			this->DoWriteData((data ? *data++ : fill) ^ flip, chip, wait);
+			this->Coord.x = ++x;	// DoWriteData() uses x for the shadow buffer
+#ifdef GLCD_BUSY_CALIBRATE
+			wait = this->BusyPolls;	// zero when the chip is always ready for the next byte
+#endif
+		} while(--n);
+
+		/*
+		 * x is now at the next chip but it has not been positioned
+		 */
+		this->Coord.x = -1;
+	}
+
+	/*
+	 * If the run ended on a chip boundary, the next chip still needs
+	 * to be positioned for any following WriteData()
+	 */
+	if(x < DISPLAY_WIDTH && glcd_DevXYval2Chip(x, y) != chip)
+		this->GotoXY(x, y);
+	else
+		this->Coord.x = x;
+}
+
+/**
+ * Read a horizontal run of bytes from display device memory
+ *
+ * @param x X coordinate of the first byte
+ * @param y Y coordinate of the LCD page, the low 3 bits are ignored
+ * @param count number of bytes
+ * @param data where the bytes are stored
+ *
+ * This is the same as count ReadData() calls on a page boundary,
+ * each followed by a GotoXY() to the next column, but each chip
+ * is only positioned once with a single dummy read and the rest
+ * of the bytes come from the column auto-increment of the chip.
+ * The run is clipped at the right edge of the display.
+ *
+ * @note the x location is not kept, a GotoXY() is needed
+ * before the next ReadData() or WriteData().
+ *
+ * @see WriteSpan()
+ * @see ReadData()
+ */
+void glcd_Device::ReadSpan(uint8_t x, uint8_t y, uint8_t count, uint8_t *data)
+{
+uint8_t flip = this->Inverted ? 0xff : 0;
+#ifndef GLCD_SHADOW_BUFFER
+uint8_t n;
+#endif
+
+	if(x >= DISPLAY_WIDTH || y >= DISPLAY_HEIGHT)
+		return;
+	if(count > DISPLAY_WIDTH - x)
+		count = DISPLAY_WIDTH - x;
+	y &= ~7;
+
+#ifdef GLCD_SHADOW_BUFFER
+	/*
+	 * The shadow copy holds exactly what is in glcd memory
+	 */
+	while(count--)
+		*data++ = this->Shadow[y/8][x++] ^ flip;
+#else
+	while(count)
+	{
+#ifdef CHIP_WIDTH
+		n = CHIP_WIDTH - glcd_DevXval2ChipCol(x);
+		if(n > count)
+#endif
+			n = count;
+		count -= n;
+		x += n;
+
+		this->GotoXY(x - n, y);
+		this->DoReadData();				// dummy read
+		do
+		{
+			*data++ = this->DoReadData() ^ flip;
+		} while(--n);
+
+		/*
+		 * the reads moved the h/w column
+		 */
+		this->Coord.x = -1;
+	}
+#endif
+}
+
+/**
+ * Write a horizontal run of bytes to display device memory
+ *
+ * @param x X coordinate of the first byte
+ * @param y Y coordinate of the LCD page, the low 3 bits are ignored
+ * @param count number of bytes
+ * @param data the bytes to write
+ *
+ * This is the same as a GotoXY() followed by count WriteData() calls
+ * on a page boundary, but the run is only split across chips once, and
+ * consecutive bytes are streamed to each chip with no repositioning.
+ * The run is clipped at the right edge of the display.
+ *
+ * @see FillSpan()
+ * @see WriteData()
+ */
+void glcd_Device::WriteSpan(uint8_t x, uint8_t y, uint8_t count, const uint8_t *data)
+{
+	this->DoWriteSpan(x, y, count, data, 0, this->Inverted ? 0xff : 0);
+}
+
+/**
+ * Write the same byte to a horizontal run of display device memory
+ *
+ * @param x X coordinate of the first byte
+ * @param y Y coordinate of the LCD page, the low 3 bits are ignored
+ * @param count number of bytes
+ * @param value the byte to write, BLACK or WHITE fill the run
+ *
+ * @see WriteSpan()
+ */
+void glcd_Device::FillSpan(uint8_t x, uint8_t y, uint8_t count, uint8_t value)
+{
+	this->DoWriteSpan(x, y, count, 0, value, this->Inverted ? 0xff : 0);
+}
+
+/**
+ * set the update mode
+ *
+ * @param mode UPDATE_IMMEDIATE or UPDATE_DEFERRED
+ *
+ * In UPDATE_IMMEDIATE mode, the default, all drawing is sent to the glcd
+ * as it is done.
+ *
+ * In UPDATE_DEFERRED mode drawing only changes the RAM copy of the display
+ * and the columns changed on each page are remembered.
+ * Nothing appears on the glcd until Update() is called.
+ * This is much faster for animations that redraw a lot of the display
+ * since each changed column is only sent once per frame.
+ *
+ * Switching back to UPDATE_IMMEDIATE does an Update().
+ *
+ * @note Deferred mode needs GLCD_SHADOW_BUFFER in glcd_Config.h.
+ * Without it the mode is ignored and all updates are immediate.
+ *
+ * @see Update()
+ */
+
+void glcd_Device::SetUpdateMode(uint8_t mode)
+{
+#ifdef GLCD_SHADOW_BUFFER
+	if(mode == this->Deferred)
+		return;
+
+	if(mode == UPDATE_DEFERRED)
+	{
+		for(uint8_t page = 0; page < (DISPLAY_HEIGHT+7)/8; page++)
+		{
+			this->DirtyX1[page] = 0xff;
+			this->DirtyX2[page] = 0;
+		}
+		this->Deferred = UPDATE_DEFERRED;
+	}
+	else
+	{
+		this->Update();
+		this->Deferred = UPDATE_IMMEDIATE;
+	}
+#else
+	(void) mode;	/* every update is immediate without a shadow buffer */
+#endif
+}
+
+/**
+ * send deferred changes to the glcd
+ *
+ * Writes the changed columns of each page to the glcd.
+ * There is one set address per page, plus one for each chip
+ * the span crosses into.
+ *
+ * The current x,y location is not changed.
+ *
+ * @see SetUpdateMode()
+ */
+
+void glcd_Device::Update(void)
+{
+#ifdef GLCD_SHADOW_BUFFER
+uint8_t x, x2;
+uint8_t xsave = this->Coord.x;
+uint8_t ysave = this->Coord.y;
+uint8_t deferred = this->Deferred;
+
+	this->Deferred = UPDATE_IMMEDIATE;
+
+	for(uint8_t page = 0; page < (DISPLAY_HEIGHT+7)/8; page++)
+	{
+		x = this->DirtyX1[page];
+		x2 = this->DirtyX2[page];
+		if(x > x2)
+			continue;
+
+		this->DirtyX1[page] = 0xff;
+		this->DirtyX2[page] = 0;
+
+		/*
+		 * the shadow already holds any inversion
+		 */
+		this->Coord.x = -1;		// force a GotoXY() on the first column
+		this->DoWriteSpan(x, page * 8, x2 - x + 1, &this->Shadow[page][x], 0, 0);
+	}
+
+	/*
+	 * The h/w column is now somewhere else so force
+	 * a set column on the next GotoXY()
+	 */
+	this->Coord.x = -1;
+	this->GotoXY(xsave, ysave);
+	this->Coord.x = xsave;
+	this->Coord.y = ysave;
+	this->Deferred = deferred;
+#endif
+}
+
+#ifdef GLCD_HW_SCROLL
+/**
+ * scroll the entire display by whole LCD pages
+ *
+ * @param pages number of pages to scroll, positive is up and negative is down
+ *
+ * Only the display start line is changed, no display memory is read or written.
+ * The pages scrolled onto the display still hold what scrolled off
+ * and must be redrawn by the caller.
+ *
+ * @returns true if the display was scrolled.
+ * Nothing is done in deferred update mode since the scroll would show
+ * before the drawing it is supposed to follow.
+ */
+
+uint8_t glcd_Device::ScrollPages(int8_t pages)
+{
+#ifdef GLCD_SHADOW_BUFFER
+	if(this->Deferred)
+		return(false);
+
+	/*
+	 * The shadow is kept in display order, not glcd memory order
+	 */
+	if(pages > 0)
+		memmove(this->Shadow[0], this->Shadow[pages], (DISPLAY_HEIGHT/8 - pages) * DISPLAY_WIDTH);
+	else
+		memmove(this->Shadow[-pages], this->Shadow[0], (DISPLAY_HEIGHT/8 + pages) * DISPLAY_WIDTH);
+#endif
+
+	this->StartPage = (this->StartPage + pages + DISPLAY_HEIGHT/8) % (DISPLAY_HEIGHT/8);
+	for(uint8_t chip=0; chip < glcd_CHIP_COUNT; chip++)
+	{
+		this->WriteCommand(LCD_DISP_START | (this->StartPage * 8), chip);
+	}
+
+	/*
+	 * The page for the current y is now a different glcd memory page
+	 * so force a set address on the next GotoXY()
+	 */
+	this->Coord.x = -1;
+	return(true);
+}
+#endif
+
+/*
+ * Advance to the next column after a write that spans two LCD pages.
+ *
+ * Like the single page write, the column is allowed to go beyond the
+ * right edge so following writes are dropped rather than landing in
+ * whatever column the h/w address wrapped to.
+ */
+void glcd_Device::NextColumn(uint8_t y)
+{
+	if(this->Coord.x+1 < DISPLAY_WIDTH)
+	{
+		this->GotoXY(this->Coord.x+1, y);
+	}
+	else
+	{
+		this->Coord.x++;
+		this->Coord.y = y;
+	}
+}
+
 /*
  * needed to resolve virtual print functions
  */
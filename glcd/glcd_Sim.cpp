@@ -0,0 +1,254 @@
+/*
+  glcd_Sim.cpp - in memory model of a ks0108 glcd panel
+  Copyright (c) 2010 Michael Margolis and Bill Perry 
+  
+  vi:ts=4  
+
+  This file is part of the Arduino GLCD library.
+
+  GLCD is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as published by
+  the Free Software Foundation, either version 2.1 of the License, or
+  (at your option) any later version.
+
+  GLCD is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with GLCD.  If not, see <http://www.gnu.org/licenses/>.
+ 
+  This file is only compiled into the library when the panel configuration
+  defines GLCD_SIM_DEVICE. See config/sim_Panel.h
+
+*/
+
+#include <avr/pgmspace.h> // the host stand-in defines GLCD_SIM
+#include "glcd_Config.h"
+
+#ifdef GLCD_SIM_DEVICE
+
+#include <string.h>
+#include "include/glcd_io.h"
+
+/*
+ * define the static variables declared in glcd_Sim
+ */
+
+glcd_SimCounters glcd_Sim::Count;
+uint8_t glcd_Sim::BusyPolls;
+uint8_t glcd_Sim::Chip;
+uint8_t glcd_Sim::Bus;
+uint8_t glcd_Sim::Dir;
+uint8_t glcd_Sim::DI;
+uint8_t glcd_Sim::RW;
+uint8_t glcd_Sim::EN;
+uint8_t glcd_Sim::Busy;
+struct glcd_Sim::chip_t glcd_Sim::Panel[glcd_CHIP_COUNT];
+
+/**
+ * Power on reset of the panel model
+ *
+ * Display memory is filled with a pattern to catch code that
+ * depends on memory that has not been written.
+ * The counters are cleared.
+ */
+void glcd_Sim::Reset(void)
+{
+	for(uint8_t chip = 0; chip < glcd_CHIP_COUNT; chip++)
+	{
+		memset(Panel[chip].mem, 0xA5, sizeof(Panel[chip].mem));
+		Panel[chip].page = 0;
+		Panel[chip].col = 0;
+		Panel[chip].startLine = 0;
+		Panel[chip].on = 0;
+		Panel[chip].outReg = 0;
+	}
+	Chip = 0;
+	DI = RW = EN = 0;
+	Busy = 0;
+	ClearCounters();
+}
+
+/**
+ * Clear the bus operation counters
+ */
+void glcd_Sim::ClearCounters(void)
+{
+	memset(&Count, 0, sizeof(Count));
+}
+
+/*
+ * Control line change.
+ * EN rising edge puts status or read data on the bus and
+ * EN falling edge completes the bus cycle.
+ */
+void glcd_Sim::WritePin(uint8_t pin, uint8_t val)
+{
+	val = val ? 1 : 0;
+
+	if(pin == glcdDI)
+		DI = val;
+	else if(pin == glcdRW)
+		RW = val;
+	else if(pin == glcdEN && val != EN)
+	{
+		EN = val;
+		if(EN)
+			Strobe();
+		else
+			Latch();
+	}
+}
+
+/*
+ * EN went high
+ */
+void glcd_Sim::Strobe(void)
+{
+struct chip_t *cp = &Panel[Chip];
+
+	Count.strobes++;
+	if(!RW)
+		return;
+
+	if(!DI)
+	{
+		/*
+		 * status read
+		 */
+		Count.statusReads++;
+		Bus = (cp->on ? 0 : 0x20);
+		if(Busy)
+			Bus |= LCD_BUSY_FLAG;
+	}
+	else
+	{
+		/*
+		 * data read returns output register
+		 */
+		Count.dataReads++;
+		Bus = cp->outReg;
+	}
+}
+
+/*
+ * EN went low
+ */
+void glcd_Sim::Latch(void)
+{
+struct chip_t *cp = &Panel[Chip];
+
+	if(RW)
+	{
+		/*
+		 * load output register after a data read and advance the column
+		 */
+		if(DI)
+		{
+			cp->outReg = cp->mem[cp->page][cp->col];
+			cp->col = (cp->col + 1) % CHIP_WIDTH;
+		}
+		return;
+	}
+
+	if(Busy)
+		Count.busyWrites++;
+	if(DI)
+	{
+		Count.dataWrites++;
+		cp->mem[cp->page][cp->col] = Bus;
+		cp->col = (cp->col + 1) % CHIP_WIDTH;
+	}
+	else
+	{
+		Count.commands++;
+		if((Bus & 0xFE) == (LCD_ON & 0xFE))
+			cp->on = Bus & 1;
+		else if((Bus & 0xC0) == LCD_SET_ADD)
+			cp->col = (Bus & 0x3F) % CHIP_WIDTH;
+		else if((Bus & 0xF8) == LCD_SET_PAGE)
+			cp->page = (Bus & 7) % (CHIP_HEIGHT/8);
+		else if((Bus & 0xC0) == LCD_DISP_START)
+			cp->startLine = (Bus & 0x3F) % CHIP_HEIGHT;
+	}
+	Busy = BusyPolls;
+}
+
+/*
+ * Status poll, only valid while EN is high.
+ * The busy flag clears after BusyPolls polls.
+ */
+uint8_t glcd_Sim::IsBusy(void)
+{
+	if(!Busy)
+		return(0);
+	Count.busyPolls++;
+	if(--Busy == 0)
+		Bus &= ~LCD_BUSY_FLAG;
+	return(1);
+}
+
+/**
+ * Read a pixel as it is seen on the panel
+ *
+ * @param x X coordinate
+ * @param y Y coordinate
+ *
+ * @return 1 for a dark pixel and 0 for a light pixel
+ *
+ * The start line of the chip is applied so this is the
+ * image the user would see.
+ */
+uint8_t glcd_Sim::GetPixel(uint8_t x, uint8_t y)
+{
+uint8_t chip = glcd_DevXYval2Chip(x, y);
+struct chip_t *cp = &Panel[chip];
+uint8_t row = (y % CHIP_HEIGHT + cp->startLine) % CHIP_HEIGHT;
+
+	if(!cp->on)
+		return(0);
+	return((cp->mem[row/8][glcd_DevXval2ChipCol(x)] >> (row & 7)) & 1);
+}
+
+/**
+ * Write the panel image as a plain PBM file
+ *
+ * @param fp open file
+ *
+ * @return 0 for success, -1 for a write error
+ */
+int glcd_Sim::WritePBM(FILE *fp)
+{
+	fprintf(fp, "P1\n%d %d\n", DISPLAY_WIDTH, DISPLAY_HEIGHT);
+	for(uint8_t y = 0; y < DISPLAY_HEIGHT; y++)
+	{
+		for(uint8_t x = 0; x < DISPLAY_WIDTH; x++)
+			fputc(GetPixel(x, y) ? '1' : '0', fp);
+		fputc('\n', fp);
+	}
+	return(ferror(fp) ? -1 : 0);
+}
+
+/**
+ * Write the panel image to a plain PBM file
+ *
+ * @param name file name
+ *
+ * @return 0 for success, -1 for an error
+ */
+int glcd_Sim::WritePBM(const char *name)
+{
+FILE *fp = fopen(name, "w");
+int ret;
+
+	if(!fp)
+		return(-1);
+	ret = WritePBM(fp);
+	if(fclose(fp))
+		ret = -1;
+	return(ret);
+}
+
+#endif // GLCD_SIM_DEVICE
@@ -25,10 +25,12 @@
 #define GTEXT_H
 
 #include <inttypes.h>
+#include <stdarg.h>
 #include <avr/pgmspace.h>
 
 #include "include/Streaming.h" 
 #include "include/glcd_Device.h"
+#include "include/glcd_rle.h"
 
 
 #define GTEXT_VERSION 1 // software version of this code
@@ -52,6 +54,14 @@ typedef class _FlashString {} *FLASHSTRING;
 // zero length is flag indicating fixed width font (array does not contain width data entries)
 #define isFixedWidthFont(font)  (FontRead(font+FONT_LENGTH) == 0 && FontRead(font+FONT_LENGTH+1) == 0))
 
+// the following returns true if the given font is run length encoded
+// a length of 0xffff is the flag for a compressed font. After the width table (one entry
+// for each character even if all widths are the same) there is a 2 byte offset, high byte first,
+// for each character to its encoded glyph data, counted from the end of the offset table.
+// The glyph data is encoded as described in glcd_rle.h and the bits of the last
+// page of glyphs are already aligned with LCD memory.
+#define isRleFont(font)  (FontRead(font+FONT_LENGTH) == 0xff && FontRead(font+FONT_LENGTH+1) == 0xff)
+
 /*
  * Coodinates for predefined areas are compressed into a single 32 bit token.
  *
@@ -179,6 +189,19 @@ struct tarea
 	uint8_t y2;
 	int8_t  mode;
 };
+
+typedef struct {
+	uint8_t height;		// glyph height in pixels
+	uint8_t firstChar;
+	uint8_t charCount;
+	uint8_t fixedWidth;	// width of every glyph in a fixed width font, 0 if variable width
+	uint8_t rle;		// true for a run length encoded font
+} fontInfo;
+
+typedef struct {
+	uint16_t index;		// offset of the glyph data in the font
+	uint8_t width;		// glyph width in pixels, not including the 1 pixel pad
+} glyphInfo;
 /// @endcond
 
 /**
@@ -205,10 +228,23 @@ class gText : public glcd_Device
 #endif
 
 	void SpecialChar(uint8_t c);
+	void GetFontInfo(fontInfo *font);
+	uint8_t FindGlyph(uint8_t c, fontInfo *font, glyphInfo *glyph);
+	void DrawGlyphs(fontInfo *font, glyphInfo *glyphs, uint8_t count);
+	void PutRun(const char *str, uint16_t len, uint8_t progmem);
+#ifndef GLCD_NO_PRINTF
+	void Format(const char *format, uint8_t progmem, va_list ap);
+	void FormatField(const char *str, uint16_t len, uint8_t progmem, uint8_t width, uint8_t left);
+#endif
+#ifdef GLCD_FONT_INDEX
+	uint16_t GlyphIndex(uint8_t c, uint8_t charCount);
+#endif
 
 	// Scroll routines are private for now
 	void ScrollUp(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pixels, uint8_t color);
 	void ScrollDown(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, uint8_t pixels, uint8_t color);
+	void ScrollArea(uint8_t x1, uint8_t y1, uint8_t x2, uint8_t y2, int16_t delta, uint8_t color);
+	void ScrollRead(uint8_t x, uint8_t count, int16_t sp, uint8_t first, uint8_t last, uint8_t *data);
 
   public:
 	gText(); // default - uses the entire display
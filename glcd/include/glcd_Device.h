@@ -43,6 +43,10 @@
 #define NON_INVERTED false
 #define INVERTED     true
 
+// update modes, see SetUpdateMode()
+#define UPDATE_IMMEDIATE 0
+#define UPDATE_DEFERRED  1
+
 // Colors
 #define BLACK				0xFF
 #define WHITE				0x00
@@ -82,6 +86,12 @@ class glcd_Device : public Print
 	inline void SelectChip(uint8_t chip); 
 	void WaitReady(uint8_t chip);
 	void WaitReset(uint8_t chip); // doesnt always exist, depends on ifdefs in code
+	void DoWriteData(uint8_t data, uint8_t chip, uint8_t wait = true);
+	void DoWriteSpan(uint8_t x, uint8_t y, uint8_t count, const uint8_t *data, uint8_t fill, uint8_t flip);
+	void NextColumn(uint8_t y);
+#ifdef GLCD_BUSY_CALIBRATE
+	void CalibrateBusy(void);
+#endif
 	void write(uint8_t); // for Print base class
 	
   public:
@@ -92,10 +102,30 @@ class glcd_Device : public Print
 	void SetPixels(uint8_t x, uint8_t y,uint8_t x1, uint8_t y1, uint8_t color);
     uint8_t ReadData(void);        // now public
     void WriteData(uint8_t data); 
+	void ReadSpan(uint8_t x, uint8_t y, uint8_t count, uint8_t *data);
+	void WriteSpan(uint8_t x, uint8_t y, uint8_t count, const uint8_t *data);
+	void FillSpan(uint8_t x, uint8_t y, uint8_t count, uint8_t value);
+	void SetUpdateMode(uint8_t mode);
+	void Update(void);
+#ifdef GLCD_HW_SCROLL
+	uint8_t ScrollPages(int8_t pages);
+#endif
 
   	void GotoXY(uint8_t x, uint8_t y);   
     static lcdCoord	  	Coord;  
 	static uint8_t	 	Inverted; 
+#ifdef GLCD_SHADOW_BUFFER
+	static uint8_t		Shadow[(DISPLAY_HEIGHT+7)/8][DISPLAY_WIDTH]; // RAM copy of glcd display memory
+	static uint8_t		Deferred;	// true when writes only go to the shadow buffer
+	static uint8_t		DirtyX1[(DISPLAY_HEIGHT+7)/8]; // per page span of columns not yet sent to the glcd
+	static uint8_t		DirtyX2[(DISPLAY_HEIGHT+7)/8]; // the span is empty when DirtyX1 > DirtyX2
+#endif
+#ifdef GLCD_HW_SCROLL
+	static uint8_t		StartPage;	// glcd memory page shown at the top of the display
+#endif
+#ifdef GLCD_BUSY_CALIBRATE
+	static uint8_t		BusyPolls;	// most busy status polls seen after a data write by CalibrateBusy()
+#endif
 };
   
 #endif
@@ -28,6 +28,9 @@
 #ifndef	GLCD_IO_H
 #define GLCD_IO_H
 
+#ifdef GLCD_SIM_DEVICE
+#include "include/glcd_sim.h"      // in memory panel model for host builds, no avr io
+#else
 #include "include/arduino_io.h"    // these macros map arduino pins
 
 /*
@@ -39,6 +42,7 @@
 #endif
 
 #include "include/avrio.h"         // these macros do direct port io    
+#endif // GLCD_SIM_DEVICE
 
  
 /*
@@ -136,11 +140,13 @@
  * is sometimes smaller and doesn't use loops which require a
  * a register when the number cycles is less than 12.
  */
+#ifndef GLCD_SIM_DEVICE // the panel model supplies its own delay functions
 #include "include/delay.h" // Hans' Heirichs delay macros
 
 #define lcdDelayNanoseconds(__ns) _delay_cycles( (double)(F_CPU)*((double)__ns)/1.0e9 + 0.5 ) // Hans Heinrichs delay cycle routine
 
 #define lcdDelayMilliseconds(__ms) delay(__ms)	// Arduino delay function
+#endif
 
 
 /*
@@ -0,0 +1,118 @@
+/*
+  glcd_rle.h - Arduino library support for run length encoded bitmaps and fonts
+  Copyright (c) 2009,2010 Michael Margolis and Bill Perry
+
+  vi:ts=4
+
+  This file is part of the Arduino GLCD library.
+
+  GLCD is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as published by
+  the Free Software Foundation, either version 2.1 of the License, or
+  (at your option) any later version.
+
+  GLCD is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with GLCD.  If not, see <http://www.gnu.org/licenses/>.
+
+  Compressed bitmaps and fonts hold their glcd page bytes as a sequence of
+  blocks. Each block starts with a control byte c:
+
+	c < 0x80	c+1 literal data bytes follow (1 to 128)
+	c >= 0x80	the next data byte is repeated c-0x80+2 times (2 to 129)
+
+  The data is decoded a byte at a time as it is drawn so no RAM buffer
+  is needed, only the few bytes of decoder state below.
+*/
+
+#ifndef	GLCD_RLE_H
+#define GLCD_RLE_H
+
+#include <inttypes.h>
+
+#define RLE_RUN			0x80	// control byte flag for a run of a repeated byte
+#define RLE_LITERAL_MAX	128		// most literal bytes in a block
+#define RLE_RUN_MAX		129		// longest run in a block
+
+/// @cond hide_from_doxygen
+typedef struct {
+	const uint8_t *ptr;		// next byte of encoded data
+	uint8_t (*read)(const uint8_t *);	// read function for the encoded data
+	uint8_t count;			// data bytes left in the current block
+	uint8_t run;			// true if the current block is a run
+	uint8_t data;			// the repeated byte of a run
+} rleStream;
+/// @endcond
+
+/*
+ * start decoding the encoded data at ptr, reading it with read
+ */
+static inline void RleStart(rleStream *s, const uint8_t *ptr, uint8_t (*read)(const uint8_t *))
+{
+	s->ptr = ptr;
+	s->read = read;
+	s->count = 0;
+}
+
+/*
+ * read the control byte of the next block
+ */
+static inline void RleBlock(rleStream *s)
+{
+uint8_t c = s->read(s->ptr++);
+
+	if(c & RLE_RUN)
+	{
+		s->run = 1;
+		s->count = c - RLE_RUN + 2;
+		s->data = s->read(s->ptr++);
+	}
+	else
+	{
+		s->run = 0;
+		s->count = c + 1;
+	}
+}
+
+/*
+ * return the next decoded byte
+ */
+static inline uint8_t RleRead(rleStream *s)
+{
+	if(s->count == 0)
+		RleBlock(s);
+
+	s->count--;
+	if(s->run)
+		return(s->data);
+	return(s->read(s->ptr++));
+}
+
+/*
+ * skip over n decoded bytes
+ * Runs and literals are skipped a block at a time without reading the data.
+ */
+static inline void RleSkip(rleStream *s, uint16_t n)
+{
+uint8_t k;
+
+	while(n)
+	{
+		if(s->count == 0)
+			RleBlock(s);
+
+		k = s->count;
+		if(k > n)
+			k = n;
+		if(!s->run)
+			s->ptr += k;
+		s->count -= k;
+		n -= k;
+	}
+}
+
+#endif
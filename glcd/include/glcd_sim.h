@@ -0,0 +1,124 @@
+/*
+  glcd_sim.h - in memory model of a ks0108 glcd panel
+  
+  vi:ts=4
+
+  This file is part of the Arduino GLCD library.
+
+  GLCD is free software: you can redistribute it and/or modify
+  it under the terms of the GNU Lesser General Public License as published by
+  the Free Software Foundation, either version 2.1 of the License, or
+  (at your option) any later version.
+
+  GLCD is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU Lesser General Public License for more details.
+
+  You should have received a copy of the GNU Lesser General Public License
+  along with GLCD.  If not, see <http://www.gnu.org/licenses/>.
+
+  glcd_Sim replaces the avr pin i/o used by glcd_io.h when the
+  panel configuration defines GLCD_SIM_DEVICE.
+  The model keeps display memory, page and column address and start line
+  for each chip and acts on the control lines the same way as a ks0108:
+	- commands and data writes are latched on the falling edge of EN
+	- status is on the data bus while EN is high with D/I low
+	- data reads return the output register, which is then loaded
+	  from display memory so the first read after setting an address
+	  is a dummy read.
+
+  Every strobe, command, read and write is counted and the nanosecond
+  delays requested by the library are added up so drawing code can be
+  benchmarked off target.
+ 
+ */
+
+#ifndef	GLCD_SIM_H
+#define GLCD_SIM_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include "glcd_Config.h"
+
+/// @cond hide_from_doxygen
+typedef struct {
+	uint32_t strobes;		// EN high pulses
+	uint32_t commands;		// commands written
+	uint32_t dataWrites;	// display data bytes written
+	uint32_t dataReads;		// display data bytes read, including dummy reads
+	uint32_t statusReads;	// status register reads
+	uint32_t busyPolls;		// status reads that returned busy
+	uint32_t busyWrites;	// commands and data written while still busy, these are lost on a real panel
+	uint32_t delayNs;		// sum of lcdDelayNanoseconds() requests
+} glcd_SimCounters;
+/// @endcond
+
+/**
+ * @class glcd_Sim
+ * @brief In memory ks0108 panel used for host builds
+ */
+class glcd_Sim
+{
+  public:
+	static void Reset(void);
+	static void SelectChip(uint8_t chip) { Chip = chip; }
+	static void WritePin(uint8_t pin, uint8_t val);
+	static void DataOut(uint8_t data) { Bus = data; }
+	static uint8_t DataIn(void) { return(Bus); }
+	static void DataDir(uint8_t dir) { Dir = dir; }
+	static uint8_t IsBusy(void);
+	static void Delay(uint32_t ns) { Count.delayNs += ns; }
+
+	static uint8_t GetPixel(uint8_t x, uint8_t y);
+	static uint8_t GetStartLine(uint8_t chip) { return(Panel[chip].startLine); }
+	static int WritePBM(FILE *fp);
+	static int WritePBM(const char *name);
+
+	static void ClearCounters(void);
+
+	static glcd_SimCounters Count;	// bus operation counters
+	static uint8_t BusyPolls;		// status polls that read busy after each write
+
+  private:
+	static void Strobe(void);
+	static void Latch(void);
+
+	static uint8_t Chip;
+	static uint8_t Bus;
+	static uint8_t Dir;
+	static uint8_t DI, RW, EN;
+	static uint8_t Busy;
+
+	static struct chip_t {
+		uint8_t page;
+		uint8_t col;
+		uint8_t startLine;
+		uint8_t on;
+		uint8_t outReg;
+		uint8_t mem[CHIP_HEIGHT/8][CHIP_WIDTH];
+	} Panel[glcd_CHIP_COUNT];
+};
+
+/*
+ * Map the glcd_io.h primitives to the panel model
+ */
+#define lcdfastWrite(pin, pinval)	glcd_Sim::WritePin(pin, pinval)
+
+#define OUTPUT 1
+#define lcdPinMode(pin, mode)
+
+#define lcdDataOut(data)	glcd_Sim::DataOut(data)
+#define lcdDataIn()			glcd_Sim::DataIn()
+#define lcdDataDir(dirbits)	glcd_Sim::DataDir(dirbits)
+
+#define lcdIsBusy()			glcd_Sim::IsBusy()
+#define lcdIsReset()		0
+
+#define lcdReset()		
+#define lcdUnReset()		
+
+#define lcdDelayNanoseconds(__ns)	glcd_Sim::Delay(__ns)
+#define lcdDelayMilliseconds(__ms)	glcd_Sim::Delay((uint32_t)(__ms) * 1000000UL)
+
+#endif // GLCD_SIM_H
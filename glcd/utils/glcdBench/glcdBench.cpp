@@ -0,0 +1,36 @@
+/*
+ * glcdBench
+ *
+ * Runs the GLCDbench example sketch with the simulated panel
+ * and prints the glcd bus operations each primitive needs per frame.
+ *
+ * This runs on your computer, its not an Arduino sketch.
+ * Build and run it from the glcd directory:
+ *
+ *   g++ -Iutils/host -I. -o glcdBench utils/glcdBench/glcdBench.cpp \
+ *       glcd.cpp gText.cpp glcd_Device.cpp glcd_Sim.cpp
+ *   ./glcdBench > before.txt
+ *
+ * Add -D options to the g++ command to try glcd_Config.h options,
+ * for example -DGLCD_SHADOW_BUFFER
+ *
+ * Running it again after a library change and comparing the outputs,
+ * for example with diff, shows the primitives whose bus traffic changed.
+ * The counts do not depend on the speed of the computer.
+ *
+ * If a file name is given the final display is also written to it
+ * as a PBM image.
+ */
+
+#include "WProgram.h"
+
+#include "examples/GLCDbench/GLCDbench.pde"
+
+int main(int argc, char **argv)
+{
+	glcd_Sim::Reset();
+	setup();
+	if(argc > 1)
+		return(glcd_Sim::WritePBM(argv[1]));
+	return(0);
+}
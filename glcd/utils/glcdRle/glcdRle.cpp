@@ -0,0 +1,196 @@
+/*
+ * glcdRle
+ *
+ * Creates a run length encoded copy of a glcd font or bitmap.
+ * The encoded format is described in include/glcd_rle.h
+ *
+ * This runs on your computer, its not an Arduino sketch.
+ * The font or bitmap header is compiled into the program, for example
+ * from the glcd directory:
+ *
+ *   g++ -Iutils/host -I. -DFONT=CalBlk36 -DHEADER='"fonts/CalBlk36.h"' -o glcdRle utils/glcdRle/glcdRle.cpp
+ *   ./glcdRle > fonts/CalBlk36Rle.h
+ *
+ * or for a bitmap made with glcdMakeBitmap:
+ *
+ *   g++ -Iutils/host -I. -DBITMAP=ArduinoIcon64x64 -DHEADER='"bitmaps/ArduinoIcon64x64.h"' -o glcdRle utils/glcdRle/glcdRle.cpp
+ *   ./glcdRle > bitmaps/ArduinoIcon64x64Rle.h
+ *
+ * The encoded copy has the same name with Rle added.
+ */
+
+#include <stdio.h>
+#include <inttypes.h>
+#include <vector>
+
+#include HEADER
+
+#include "glcd.h"
+
+#define STR2(x) #x
+#define STR(x) STR2(x)
+
+using namespace std;
+
+/*
+ * length of the run of identical bytes starting at data[i]
+ */
+static unsigned runLength(const vector<uint8_t> &data, unsigned i)
+{
+unsigned n = 1;
+
+	while(i + n < data.size() && data[i + n] == data[i] && n < RLE_RUN_MAX)
+		n++;
+	return(n);
+}
+
+/*
+ * encode data as blocks of runs and literals
+ * A run is only started for 3 or more bytes inside literal data
+ * since a 2 byte run costs as much as the control byte it saves.
+ */
+static vector<uint8_t> rleEncode(const vector<uint8_t> &data)
+{
+vector<uint8_t> out;
+unsigned i = 0;
+unsigned start, n;
+
+	while(i < data.size())
+	{
+		n = runLength(data, i);
+		if(n >= 2)
+		{
+			out.push_back(RLE_RUN + n - 2);
+			out.push_back(data[i]);
+			i += n;
+			continue;
+		}
+
+		start = i;
+		while(i < data.size() && i - start < RLE_LITERAL_MAX && runLength(data, i) < 3)
+			i++;
+		out.push_back(i - start - 1);
+		out.insert(out.end(), data.begin() + start, data.begin() + i);
+	}
+	return(out);
+}
+
+static void printBytes(const vector<uint8_t> &data)
+{
+	for(unsigned i = 0; i < data.size(); i++)
+	{
+		printf("%s0x%02x,", i % 16 ? " " : "    ", data[i]);
+		if(i % 16 == 15 || i == data.size() - 1)
+			printf("\n");
+	}
+}
+
+static void printHeader(const char *name, unsigned size, unsigned rawSize)
+{
+	printf("/* %sRle.h run length encoded copy of %s for the GLCD library */\n", name, name);
+	printf("/* Created by glcdRle from %s */\n", HEADER);
+	printf("/* %u bytes, %u bytes unencoded */\n\n", size, rawSize);
+	printf("#include <inttypes.h>\n");
+	printf("#include <avr/pgmspace.h>\n\n");
+	printf("#ifndef %sRle_H\n", name);
+	printf("#define %sRle_H\n\n", name);
+	printf("static uint8_t %sRle[] PROGMEM = {\n", name);
+}
+
+#ifdef FONT
+static void encodeFont(const uint8_t *font, const char *name, unsigned rawSize)
+{
+uint8_t fixedWidth = font[FONT_FIXED_WIDTH];
+uint8_t height = font[FONT_HEIGHT];
+uint8_t firstChar = font[FONT_FIRST_CHAR];
+uint8_t charCount = font[FONT_CHAR_COUNT];
+uint8_t bytes = (height + 7) / 8;
+uint8_t fixed = font[FONT_LENGTH] == 0 && font[FONT_LENGTH+1] == 0;
+vector<uint8_t> widths, offsets;
+vector<vector<uint8_t> > glyphs;
+const uint8_t *glyph;
+unsigned offset = 0;
+unsigned size;
+
+	glyph = font + FONT_WIDTH_TABLE + (fixed ? 0 : charCount);
+	for(unsigned c = 0; c < charCount; c++)
+	{
+		uint8_t width = fixed ? fixedWidth : font[FONT_WIDTH_TABLE + c];
+
+		/*
+		 * Some fonts have a char count larger than the glyphs they hold
+		 */
+		if(glyph + width * bytes > font + rawSize)
+		{
+			fprintf(stderr, "%s only has glyphs for %u characters\n", name, c);
+			charCount = c;
+			break;
+		}
+
+		vector<uint8_t> data(glyph, glyph + width * bytes);
+
+		/*
+		 * Thiele fonts have the residual bits of the last page at the
+		 * wrong end of the byte, they are stored aligned with LCD memory.
+		 */
+		if(!fixed && (height & 7))
+		{
+			for(unsigned j = (bytes - 1) * width; j < data.size(); j++)
+				data[j] >>= 8 - (height & 7);
+		}
+
+		widths.push_back(width);
+		offsets.push_back(offset >> 8);
+		offsets.push_back(offset & 0xff);
+		glyphs.push_back(rleEncode(data));
+		offset += glyphs.back().size();
+		glyph += width * bytes;
+	}
+
+	size = FONT_WIDTH_TABLE + charCount * 3 + offset;
+	printHeader(name, size, rawSize);
+	printf("    0xff, 0xff, // size of 0xffff indicates compressed font\n");
+	printf("    %u, // width\n", fixedWidth);
+	printf("    %u, // height\n", height);
+	printf("    %u, // first char\n", firstChar);
+	printf("    %u, // char count\n\n", charCount);
+	printf("    // char widths\n");
+	printBytes(widths);
+	printf("\n    // glyph offsets\n");
+	printBytes(offsets);
+	for(unsigned c = 0; c < charCount; c++)
+	{
+		printf("\n    // char %u\n", firstChar + c);
+		printBytes(glyphs[c]);
+	}
+	printf("};\n\n#endif\n");
+}
+#endif
+
+#ifdef BITMAP
+static void encodeBitmap(const uint8_t *bitmap, const char *name, unsigned rawSize)
+{
+uint8_t width = bitmap[0];
+uint8_t height = bitmap[1];
+vector<uint8_t> data(bitmap + 2, bitmap + 2 + width * ((height + 7) / 8));
+vector<uint8_t> rle = rleEncode(data);
+
+	printHeader(name, 2 + rle.size(), rawSize);
+	printf("  %u, // width\n", width);
+	printf("  0x%02x, // height %u, compressed\n", height | BITMAP_RLE, height);
+	printBytes(rle);
+	printf("};\n\n#endif\n");
+}
+#endif
+
+int main(void)
+{
+#if defined(FONT)
+	encodeFont(FONT, STR(FONT), sizeof(FONT));
+#elif defined(BITMAP)
+	encodeBitmap(BITMAP, STR(BITMAP), sizeof(BITMAP));
+#else
+#error define FONT or BITMAP to the name of the font or bitmap array
+#endif
+	return(0);
+}
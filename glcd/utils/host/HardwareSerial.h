@@ -0,0 +1,23 @@
+/*
+ * HardwareSerial.h - host stand-in for the Arduino serial port
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ * Serial output goes to stdout, the carriage returns of println() are dropped.
+ */
+#ifndef GLCD_HOST_HARDWARESERIAL_H
+#define GLCD_HOST_HARDWARESERIAL_H
+
+#include <stdio.h>
+#include "Print.h"
+
+class HardwareSerial : public Print
+{
+  public:
+	void begin(long) {}
+	using Print::write;
+	virtual void write(uint8_t c) { if(c != '\r') putchar(c); }
+};
+
+static HardwareSerial Serial;
+
+#endif
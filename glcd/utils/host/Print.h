@@ -0,0 +1,63 @@
+/*
+ * Print.h - host stand-in for the Arduino Print class
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ */
+#ifndef GLCD_HOST_PRINT_H
+#define GLCD_HOST_PRINT_H
+
+#include <inttypes.h>
+#include <stdio.h>
+#include "wiring.h"
+
+class Print
+{
+  public:
+	virtual void write(uint8_t) = 0;
+	virtual void write(const char *str) { while(*str) write((uint8_t)*str++); }
+	virtual void write(const uint8_t *buf, size_t size) { while(size--) write(*buf++); }
+
+	void print(const char *str) { write(str); }
+	void print(char c, int base = BYTE) { if(base == BYTE) write((uint8_t)c); else print((long)c, base); }
+	void print(unsigned char b, int base = BYTE) { if(base == BYTE) write(b); else print((unsigned long)b, base); }
+	void print(int n, int base = DEC) { print((long)n, base); }
+	void print(unsigned int n, int base = DEC) { print((unsigned long)n, base); }
+	void print(long n, int base = DEC)
+	{
+		if(base == DEC && n < 0)
+		{
+			write('-');
+			n = -n;
+		}
+		print((unsigned long)n, base);
+	}
+	void print(unsigned long n, int base = DEC)
+	{
+	char buf[8 * sizeof(long) + 1];
+	char *str = &buf[sizeof(buf) - 1];
+
+		if(base < 2)
+			base = 10;
+		*str = '\0';
+		do {
+			unsigned long m = n;
+			n /= base;
+			char c = m - base * n;
+			*--str = c < 10 ? c + '0' : c + 'A' - 10;
+		} while(n);
+		write(str);
+	}
+	void print(double n, int digits = 2)
+	{
+	char buf[32];
+
+		snprintf(buf, sizeof(buf), "%.*f", digits, n);
+		write(buf);
+	}
+
+	void println(void) { write('\r'); write('\n'); }
+	template<class T> void println(T arg) { print(arg); println(); }
+	template<class T> void println(T arg, int base) { print(arg, base); println(); }
+};
+
+#endif
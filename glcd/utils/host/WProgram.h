@@ -0,0 +1,14 @@
+/*
+ * WProgram.h - host stand-in for the Arduino core
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ */
+#ifndef GLCD_HOST_WPROGRAM_H
+#define GLCD_HOST_WPROGRAM_H
+
+#include <avr/pgmspace.h>
+#include "wiring.h"
+#include "Print.h"
+#include "HardwareSerial.h"
+
+#endif
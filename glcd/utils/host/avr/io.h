@@ -0,0 +1,19 @@
+/*
+ * io.h - host stand-in for avr-libc <avr/io.h>
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ */
+#ifndef GLCD_HOST_IO_H
+#define GLCD_HOST_IO_H
+
+#ifndef GLCD_SIM
+#define GLCD_SIM	// glcd_Config.h selects the simulated panel
+#endif
+
+#include <inttypes.h>
+
+#ifndef _BV
+#define _BV(bit) (1 << (bit))
+#endif
+
+#endif
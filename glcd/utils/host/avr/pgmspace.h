@@ -0,0 +1,28 @@
+/*
+ * pgmspace.h - host stand-in for avr-libc <avr/pgmspace.h>
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ * Program memory is ordinary memory on a host.
+ */
+#ifndef GLCD_HOST_PGMSPACE_H
+#define GLCD_HOST_PGMSPACE_H
+
+#ifndef GLCD_SIM
+#define GLCD_SIM	// glcd_Config.h selects the simulated panel
+#endif
+
+#include <inttypes.h>
+#include <string.h>
+
+#define PROGMEM
+#define PGM_P const char *
+#define PSTR(s) (s)
+#define pgm_read_byte(addr) (*(const uint8_t *)(addr))
+#define pgm_read_word(addr) (*(const uint16_t *)(addr))
+#define strlen_P(s) strlen(s)
+#define memcpy_P(d, s, n) memcpy(d, s, n)
+
+typedef uint8_t prog_uchar;
+typedef char prog_char;
+
+#endif
@@ -0,0 +1,54 @@
+/*
+ * wiring.h - host stand-in for the Arduino core
+ *
+ * Used with the simulated panel, see config/sim_Panel.h
+ * millis() and micros() run from the host clock.
+ */
+#ifndef GLCD_HOST_WIRING_H
+#define GLCD_HOST_WIRING_H
+
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/time.h>
+#include <unistd.h>
+#include <avr/io.h>
+
+#define HIGH 0x1
+#define LOW  0x0
+
+#define DEC 10
+#define HEX 16
+#define OCT 8
+#define BIN 2
+#define BYTE 0
+
+#define F_CPU 16000000UL
+
+typedef uint8_t boolean;
+typedef uint8_t byte;
+
+static inline unsigned long micros(void)
+{
+struct timeval tv;
+
+	gettimeofday(&tv, 0);
+	return(tv.tv_sec * 1000000UL + tv.tv_usec);
+}
+
+static inline unsigned long millis(void)
+{
+	return(micros() / 1000);
+}
+
+static inline void delay(unsigned long ms)
+{
+	usleep(ms * 1000);
+}
+
+static inline void delayMicroseconds(unsigned int us)
+{
+	usleep(us);
+}
+
+#endif